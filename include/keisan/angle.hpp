@@ -22,7 +22,12 @@
 #define KEISAN__ANGLE_HPP_
 
 #include "keisan/angle/angle.hpp"
+#include "keisan/angle/binary_angle.hpp"
+#include "keisan/angle/circular_statistics.hpp"
 #include "keisan/angle/euler.hpp"
+#include "keisan/angle/euler_order.hpp"
+#include "keisan/angle/orientation_filter.hpp"
 #include "keisan/angle/quaternion.hpp"
+#include "keisan/angle/trigonometry.hpp"
 
 #endif  // KEISAN__ANGLE_HPP_
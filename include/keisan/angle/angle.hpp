@@ -22,6 +22,8 @@
 #define KEISAN__ANGLE__ANGLE_HPP_
 
 #include <iostream>
+#include <utility>
+#include <vector>
 
 namespace keisan
 {
@@ -38,6 +40,9 @@ Angle<T> make_degree(const T & value);
 template<typename T>
 Angle<T> make_radian(const T & value);
 
+template<typename T>
+void normalize_all(std::vector<Angle<T>> & angles);
+
 template<typename T>
 Angle<IfElseFloat<T, double>> arcsin(const T & value);
 template<typename T>
@@ -57,6 +62,8 @@ public:
   friend Angle<T> make_degree<T>(const T & value);
   friend Angle<T> make_radian<T>(const T & value);
 
+  friend void normalize_all<T>(std::vector<Angle<T>> & angles);
+
   Angle();
 
 private:
@@ -96,6 +103,8 @@ public:
   IfElseFloat<T, double> cos() const;
   IfElseFloat<T, double> tan() const;
 
+  std::pair<IfElseFloat<T, double>, IfElseFloat<T, double>> sincos() const;
+
 private:
   T data;
   bool is_degree;
@@ -45,6 +45,46 @@ Angle<T> make_radian(const T & value)
   return Angle<T>(value, false);
 }
 
+template<typename T>
+void normalize_all(std::vector<Angle<T>> & angles)
+{
+  using keisan::literals::operator""_pi;
+
+  const T degree_min = -180.0;
+  const T degree_range = static_cast<T>(180.0) - degree_min;
+  const T radian_min = -1_pi;
+  const T radian_range = static_cast<T>(1_pi) - radian_min;
+
+  size_t outside_count = 0;
+  for (auto & angle : angles) {
+    T min = angle.is_degree ? degree_min : radian_min;
+    T range = angle.is_degree ? degree_range : radian_range;
+
+    outside_count += detail::is_within_period(angle.data, min, range) ? 0 : 1;
+  }
+
+  // Usually every angle is within a period, then the loop runs without any check.
+  if (outside_count == 0) {
+    for (auto & angle : angles) {
+      T min = angle.is_degree ? degree_min : radian_min;
+      T range = angle.is_degree ? degree_range : radian_range;
+
+      angle.data = detail::wrap_within_period(angle.data, min, range);
+    }
+  } else {
+    for (auto & angle : angles) {
+      T min = angle.is_degree ? degree_min : radian_min;
+      T range = angle.is_degree ? degree_range : radian_range;
+
+      if (detail::is_within_period(angle.data, min, range)) {
+        angle.data = detail::wrap_within_period(angle.data, min, range);
+      } else {
+        angle = angle.normalize();
+      }
+    }
+  }
+}
+
 template<typename T>
 Angle<IfElseFloat<T, double>> arcsin(const T & value)
 {
@@ -256,6 +296,17 @@ IfElseFloat<T, double> Angle<T>::tan() const
   }
 }
 
+template<typename T>
+std::pair<IfElseFloat<T, double>, IfElseFloat<T, double>> Angle<T>::sincos() const
+{
+  if constexpr (std::is_floating_point<T>::value) {
+    T value = radian();
+    return {std::sin(value), std::cos(value)};
+  } else {
+    return Angle<double>(*this).sincos();
+  }
+}
+
 }  // namespace keisan
 
 #endif  // KEISAN__ANGLE__ANGLE_IMPL_HPP_
@@ -0,0 +1,83 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__BINARY_ANGLE_HPP_
+#define KEISAN__ANGLE__BINARY_ANGLE_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "keisan/angle/angle.hpp"
+
+namespace keisan
+{
+
+// Angle stored as an unsigned fraction of a full turn, so integer overflow is the wrap around and
+// normalization is free. For example, BinaryAngle<uint16_t> splits a full turn into 65536 steps.
+template<typename T>
+class BinaryAngle
+{
+public:
+  static_assert(
+    std::is_unsigned<T>::value && std::numeric_limits<T>::digits >= 16,
+    "Binary angle requires an unsigned integer of at least 16 bits!");
+
+  static constexpr int bits = std::numeric_limits<T>::digits;
+
+  BinaryAngle();
+  explicit BinaryAngle(const T & value);
+
+  template<typename U>
+  explicit BinaryAngle(const Angle<U> & angle);
+
+  template<typename U>
+  operator Angle<U>() const;
+
+  bool operator==(const BinaryAngle<T> & other) const;
+  bool operator!=(const BinaryAngle<T> & other) const;
+
+  BinaryAngle<T> & operator+=(const BinaryAngle<T> & other);
+  BinaryAngle<T> & operator-=(const BinaryAngle<T> & other);
+
+  BinaryAngle<T> operator+(const BinaryAngle<T> & other) const;
+  BinaryAngle<T> operator-(const BinaryAngle<T> & other) const;
+
+  BinaryAngle<T> operator-() const;
+
+  T value() const;
+
+  double sin() const;
+  double cos() const;
+  std::pair<double, double> sincos() const;
+
+private:
+  T data;
+};
+
+}  // namespace keisan
+
+template<typename T>
+std::ostream & operator<<(std::ostream & out, const keisan::BinaryAngle<T> & angle);
+
+#include "keisan/angle/binary_angle.impl.hpp"
+
+#endif  // KEISAN__ANGLE__BINARY_ANGLE_HPP_
@@ -0,0 +1,192 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__BINARY_ANGLE_IMPL_HPP_
+#define KEISAN__ANGLE__BINARY_ANGLE_IMPL_HPP_
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "keisan/angle/binary_angle.hpp"
+#include "keisan/constant.hpp"
+
+template<typename T>
+std::ostream & operator<<(std::ostream & out, const keisan::BinaryAngle<T> & angle)
+{
+  return out << keisan::Angle<double>(angle).degree();
+}
+
+namespace keisan
+{
+
+namespace detail
+{
+
+constexpr int sine_table_bits = 12;
+
+// One full turn of sine plus a repeated first entry, so interpolation never needs to wrap.
+inline const std::array<double, (1 << sine_table_bits) + 1> & sine_table()
+{
+  static const auto table = [] {
+      std::array<double, (1 << sine_table_bits) + 1> table;
+      for (size_t i = 0; i < table.size(); ++i) {
+        table[i] = std::sin(2 * pi<double> * i / (1 << sine_table_bits));
+      }
+
+      return table;
+    }();
+
+  return table;
+}
+
+}  // namespace detail
+
+template<typename T>
+BinaryAngle<T>::BinaryAngle()
+{
+}
+
+template<typename T>
+BinaryAngle<T>::BinaryAngle(const T & value)
+: data(value)
+{
+}
+
+template<typename T>
+template<typename U>
+BinaryAngle<T>::BinaryAngle(const Angle<U> & angle)
+{
+  double turns = Angle<double>(angle).radian() / (2 * pi<double>);
+  turns -= std::floor(turns);
+
+  // Rounding up to a full turn gives 2^bits, which does not fit in T (nor in uint64_t for 64 bits),
+  // so it is wrapped back to zero before the cast.
+  double scaled = std::round(std::ldexp(turns, bits));
+  if (scaled >= std::ldexp(1.0, bits)) {
+    scaled = 0.0;
+  }
+
+  data = static_cast<T>(scaled);
+}
+
+template<typename T>
+template<typename U>
+BinaryAngle<T>::operator Angle<U>() const
+{
+  // Reading the data as signed gives the normalized range of [-pi, pi).
+  auto value = static_cast<std::make_signed_t<T>>(data);
+
+  return make_radian<U>(std::ldexp(value * 2 * pi<double>, -bits));
+}
+
+template<typename T>
+bool BinaryAngle<T>::operator==(const BinaryAngle<T> & other) const
+{
+  return data == other.data;
+}
+
+template<typename T>
+bool BinaryAngle<T>::operator!=(const BinaryAngle<T> & other) const
+{
+  return data != other.data;
+}
+
+template<typename T>
+BinaryAngle<T> & BinaryAngle<T>::operator+=(const BinaryAngle<T> & other)
+{
+  data = static_cast<T>(data + other.data);
+  return *this;
+}
+
+template<typename T>
+BinaryAngle<T> & BinaryAngle<T>::operator-=(const BinaryAngle<T> & other)
+{
+  data = static_cast<T>(data - other.data);
+  return *this;
+}
+
+template<typename T>
+BinaryAngle<T> BinaryAngle<T>::operator+(const BinaryAngle<T> & other) const
+{
+  return BinaryAngle<T>(static_cast<T>(data + other.data));
+}
+
+template<typename T>
+BinaryAngle<T> BinaryAngle<T>::operator-(const BinaryAngle<T> & other) const
+{
+  return BinaryAngle<T>(static_cast<T>(data - other.data));
+}
+
+template<typename T>
+BinaryAngle<T> BinaryAngle<T>::operator-() const
+{
+  return BinaryAngle<T>(static_cast<T>(T(0) - data));
+}
+
+template<typename T>
+T BinaryAngle<T>::value() const
+{
+  return data;
+}
+
+template<typename T>
+double BinaryAngle<T>::sin() const
+{
+  constexpr int shift = bits - detail::sine_table_bits;
+  constexpr T mask = (T(1) << shift) - 1;
+
+  const auto & table = detail::sine_table();
+
+  T index = data >> shift;
+  double fraction = std::ldexp(static_cast<double>(data & mask), -shift);
+
+  return table[index] + (table[index + 1] - table[index]) * fraction;
+}
+
+template<typename T>
+double BinaryAngle<T>::cos() const
+{
+  return (*this + BinaryAngle<T>(T(1) << (bits - 2))).sin();
+}
+
+template<typename T>
+std::pair<double, double> BinaryAngle<T>::sincos() const
+{
+  constexpr int shift = bits - detail::sine_table_bits;
+  constexpr T mask = (T(1) << shift) - 1;
+  constexpr size_t quarter = size_t(1) << (detail::sine_table_bits - 2);
+  constexpr size_t index_mask = (size_t(1) << detail::sine_table_bits) - 1;
+
+  const auto & table = detail::sine_table();
+
+  // Cosine reads the same table a quarter turn ahead, with the same fraction.
+  size_t sin_index = data >> shift;
+  size_t cos_index = (sin_index + quarter) & index_mask;
+  double fraction = std::ldexp(static_cast<double>(data & mask), -shift);
+
+  return {
+    table[sin_index] + (table[sin_index + 1] - table[sin_index]) * fraction,
+    table[cos_index] + (table[cos_index + 1] - table[cos_index]) * fraction};
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__ANGLE__BINARY_ANGLE_IMPL_HPP_
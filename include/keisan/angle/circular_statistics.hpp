@@ -0,0 +1,75 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__CIRCULAR_STATISTICS_HPP_
+#define KEISAN__ANGLE__CIRCULAR_STATISTICS_HPP_
+
+#include <vector>
+
+#include "keisan/angle/angle.hpp"
+
+namespace keisan
+{
+
+// Accumulates the weighted sum of unit vectors of angles, so the mean stays correct across the
+// -pi and pi boundary while memory stays constant regardless of the number of samples.
+template<typename T>
+class CircularStatistics
+{
+public:
+  static_assert(
+    std::is_floating_point<T>::value,
+    "Circular statistics only available for floating point angle!");
+
+  CircularStatistics();
+
+  void add(const Angle<T> & angle, const T & weight = 1);
+
+  // Runs the Precision::High polynomial sincos over fixed size blocks on the stack and sums with
+  // per lane partial sums, so the result may differ from adding the angles one by one by about
+  // 1e-7 per sample.
+  void add(const std::vector<Angle<T>> & angles);
+  void add(const std::vector<Angle<T>> & angles, const std::vector<T> & weights);
+
+  void merge(const CircularStatistics<T> & other);
+
+  void reset();
+
+  size_t count() const;
+  T total_weight() const;
+
+  Angle<T> mean() const;
+
+  T resultant_length() const;
+  T variance() const;
+  T standard_deviation() const;
+
+private:
+  T sin_sum;
+  T cos_sum;
+  T weight_sum;
+  size_t sample_count;
+};
+
+}  // namespace keisan
+
+#include "keisan/angle/circular_statistics.impl.hpp"
+
+#endif  // KEISAN__ANGLE__CIRCULAR_STATISTICS_HPP_
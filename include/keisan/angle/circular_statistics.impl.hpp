@@ -0,0 +1,170 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__CIRCULAR_STATISTICS_IMPL_HPP_
+#define KEISAN__ANGLE__CIRCULAR_STATISTICS_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "keisan/angle/circular_statistics.hpp"
+#include "keisan/angle/trigonometry.hpp"
+#include "keisan/number.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// Evaluates the unit vectors of the angles into stack buffers one block at a time, then hands each
+// block to sum(start, sines, cosines, count), so feeding a batch never allocates.
+template<typename T, typename Sum>
+void circular_blocks(const std::vector<Angle<T>> & angles, Sum sum)
+{
+  constexpr size_t block_size = 256;
+  T sines[block_size];
+  T cosines[block_size];
+
+  for (size_t start = 0; start < angles.size(); start += block_size) {
+    size_t count = std::min(block_size, angles.size() - start);
+    for (size_t i = 0; i < count; ++i) {
+      sincos_radian<Precision::High, T>(angles[start + i].radian(), sines[i], cosines[i]);
+    }
+
+    sum(start, sines, cosines, count);
+  }
+}
+
+}  // namespace detail
+
+template<typename T>
+CircularStatistics<T>::CircularStatistics()
+: sin_sum(0), cos_sum(0), weight_sum(0), sample_count(0)
+{
+}
+
+template<typename T>
+void CircularStatistics<T>::add(const Angle<T> & angle, const T & weight)
+{
+  auto [sin, cos] = angle.sincos();
+
+  sin_sum += weight * sin;
+  cos_sum += weight * cos;
+  weight_sum += weight;
+  ++sample_count;
+}
+
+template<typename T>
+void CircularStatistics<T>::add(const std::vector<Angle<T>> & angles)
+{
+  detail::circular_blocks(
+    angles, [this](size_t, const T * sines, const T * cosines, size_t count) {
+      sin_sum += detail::lane_sum(sines, count);
+      cos_sum += detail::lane_sum(cosines, count);
+    });
+
+  weight_sum += angles.size();
+  sample_count += angles.size();
+}
+
+template<typename T>
+void CircularStatistics<T>::add(
+  const std::vector<Angle<T>> & angles, const std::vector<T> & weights)
+{
+  if (angles.size() != weights.size()) {
+    throw std::invalid_argument("angles and weights must have the same size");
+  }
+
+  const T * weight = weights.data();
+  detail::circular_blocks(
+    angles, [this, weight](size_t start, const T * sines, const T * cosines, size_t count) {
+      sin_sum += detail::lane_centered_product(sines, T(0), weight + start, T(0), count);
+      cos_sum += detail::lane_centered_product(cosines, T(0), weight + start, T(0), count);
+    });
+
+  weight_sum += detail::lane_sum(weights.data(), weights.size());
+  sample_count += angles.size();
+}
+
+template<typename T>
+void CircularStatistics<T>::merge(const CircularStatistics<T> & other)
+{
+  sin_sum += other.sin_sum;
+  cos_sum += other.cos_sum;
+  weight_sum += other.weight_sum;
+  sample_count += other.sample_count;
+}
+
+template<typename T>
+void CircularStatistics<T>::reset()
+{
+  sin_sum = 0;
+  cos_sum = 0;
+  weight_sum = 0;
+  sample_count = 0;
+}
+
+template<typename T>
+size_t CircularStatistics<T>::count() const
+{
+  return sample_count;
+}
+
+template<typename T>
+T CircularStatistics<T>::total_weight() const
+{
+  return weight_sum;
+}
+
+template<typename T>
+Angle<T> CircularStatistics<T>::mean() const
+{
+  return signed_arctan(sin_sum, cos_sum);
+}
+
+template<typename T>
+T CircularStatistics<T>::resultant_length() const
+{
+  if (weight_sum <= 0) {
+    return 0;
+  }
+
+  // Rounding may push the length slightly above one for identical angles.
+  return std::min<T>(std::hypot(sin_sum, cos_sum) / weight_sum, 1);
+}
+
+template<typename T>
+T CircularStatistics<T>::variance() const
+{
+  return 1 - resultant_length();
+}
+
+template<typename T>
+T CircularStatistics<T>::standard_deviation() const
+{
+  return std::sqrt(-2 * std::log(resultant_length()));
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__ANGLE__CIRCULAR_STATISTICS_IMPL_HPP_
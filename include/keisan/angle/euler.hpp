@@ -24,6 +24,7 @@
 #include <iostream>
 
 #include "keisan/angle/angle.hpp"
+#include "keisan/angle/euler_order.hpp"
 
 namespace keisan
 {
@@ -32,17 +33,19 @@ namespace keisan
 template<typename T>
 struct Quaternion;
 
-template<typename T>
+// Tait-Bryan orders keep each angle in the member named after its axis (roll x, pitch y, yaw z),
+// proper orders such as ZXZ keep the first, second and third rotation in yaw, pitch and roll.
+template<typename T, EulerOrder Order>
 struct Euler
 {
   Euler();
   Euler(const Angle<T> & roll, const Angle<T> & pitch, const Angle<T> & yaw);
 
   template<typename U>
-  operator Euler<U>() const;
+  operator Euler<U, Order>() const;
 
-  bool operator==(const Euler<T> & other) const;
-  bool operator!=(const Euler<T> & other) const;
+  bool operator==(const Euler<T, Order> & other) const;
+  bool operator!=(const Euler<T, Order> & other) const;
 
   Quaternion<T> quaternion() const;
 
@@ -53,8 +56,8 @@ struct Euler
 
 }  // namespace keisan
 
-template<typename T>
-std::ostream & operator<<(std::ostream & out, const keisan::Euler<T> & euler);
+template<typename T, keisan::EulerOrder Order>
+std::ostream & operator<<(std::ostream & out, const keisan::Euler<T, Order> & euler);
 
 #include "keisan/angle/euler.impl.hpp"
 
@@ -24,8 +24,8 @@
 #include "keisan/angle/quaternion.hpp"
 #include "keisan/constant.hpp"
 
-template<typename T>
-std::ostream & operator<<(std::ostream & out, const keisan::Euler<T> & euler)
+template<typename T, keisan::EulerOrder Order>
+std::ostream & operator<<(std::ostream & out, const keisan::Euler<T, Order> & euler)
 {
   return out << euler.roll.degree() << " " << euler.pitch.degree() << " " << euler.yaw.degree();
 }
@@ -33,52 +33,75 @@ std::ostream & operator<<(std::ostream & out, const keisan::Euler<T> & euler)
 namespace keisan
 {
 
-template<typename T>
-Euler<T>::Euler()
+template<typename T, EulerOrder Order>
+Euler<T, Order>::Euler()
 {
 }
 
-template<typename T>
-Euler<T>::Euler(const Angle<T> & roll, const Angle<T> & pitch, const Angle<T> & yaw)
+template<typename T, EulerOrder Order>
+Euler<T, Order>::Euler(const Angle<T> & roll, const Angle<T> & pitch, const Angle<T> & yaw)
 : roll(roll), pitch(pitch), yaw(yaw)
 {
 }
 
-template<typename T>
+template<typename T, EulerOrder Order>
 template<typename U>
-Euler<T>::operator Euler<U>() const
+Euler<T, Order>::operator Euler<U, Order>() const
 {
-  return Euler<U>(roll, pitch, yaw);
+  return Euler<U, Order>(roll, pitch, yaw);
 }
 
-template<typename T>
-bool Euler<T>::operator==(const Euler<T> & other) const
+template<typename T, EulerOrder Order>
+bool Euler<T, Order>::operator==(const Euler<T, Order> & other) const
 {
   return roll == other.roll && yaw == other.yaw && pitch == other.pitch;
 }
 
-template<typename T>
-bool Euler<T>::operator!=(const Euler<T> & other) const
+template<typename T, EulerOrder Order>
+bool Euler<T, Order>::operator!=(const Euler<T, Order> & other) const
 {
   return roll != other.roll || yaw != other.yaw || pitch != other.pitch;
 }
 
-template<typename T>
-Quaternion<T> Euler<T>::quaternion() const
+template<typename T, EulerOrder Order>
+Quaternion<T> Euler<T, Order>::quaternion() const
 {
+  constexpr auto axes = detail::euler_axes(Order);
+  constexpr int i = axes[0];
+  constexpr int j = axes[1];
+
+  const auto & first = detail::euler_angle<detail::euler_member<Order>(0)>(*this);
+  const auto & second = detail::euler_angle<detail::euler_member<Order>(1)>(*this);
+  const auto & third = detail::euler_angle<detail::euler_member<Order>(2)>(*this);
+
   Quaternion<T> quaternion;
 
-  T sr = (0.5 * roll).sin();
-  T cr = (0.5 * roll).cos();
-  T sp = (0.5 * pitch).sin();
-  T cp = (0.5 * pitch).cos();
-  T sy = (0.5 * yaw).sin();
-  T cy = (0.5 * yaw).cos();
-
-  quaternion.x = sr * cp * cy - cr * sp * sy;
-  quaternion.y = cr * sp * cy + sr * cp * sy;
-  quaternion.z = cr * cp * sy - sr * sp * cy;
-  quaternion.w = cr * cp * cy + sr * sp * sy;
+  // Expanded product of the three single axis quaternions.
+  if constexpr (axes[0] != axes[2]) {
+    constexpr int k = axes[2];
+    constexpr int parity = detail::euler_parity(i, j, k);
+
+    auto [s1, c1] = (0.5 * first).sincos();
+    auto [s2, c2] = (0.5 * second).sincos();
+    auto [s3, c3] = (0.5 * third).sincos();
+
+    quaternion.w = c1 * c2 * c3 - parity * s1 * s2 * s3;
+    detail::quaternion_axis<i>(quaternion) = s1 * c2 * c3 + parity * c1 * s2 * s3;
+    detail::quaternion_axis<j>(quaternion) = c1 * s2 * c3 - parity * s1 * c2 * s3;
+    detail::quaternion_axis<k>(quaternion) = c1 * c2 * s3 + parity * s1 * s2 * c3;
+  } else {
+    constexpr int k = 3 - i - j;
+    constexpr int parity = detail::euler_parity(i, j, k);
+
+    auto [s2, c2] = (0.5 * second).sincos();
+    auto [s_sum, c_sum] = (0.5 * (first + third)).sincos();
+    auto [s_diff, c_diff] = (0.5 * (first - third)).sincos();
+
+    quaternion.w = c2 * c_sum;
+    detail::quaternion_axis<i>(quaternion) = c2 * s_sum;
+    detail::quaternion_axis<j>(quaternion) = s2 * c_diff;
+    detail::quaternion_axis<k>(quaternion) = parity * s2 * s_diff;
+  }
 
   return quaternion;
 }
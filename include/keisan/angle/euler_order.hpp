@@ -0,0 +1,128 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__EULER_ORDER_HPP_
+#define KEISAN__ANGLE__EULER_ORDER_HPP_
+
+#include <array>
+
+namespace keisan
+{
+
+// Axes of intrinsic rotations in the order they are applied, so ZYX composes
+// Rz(yaw) * Ry(pitch) * Rx(roll). Tait-Bryan orders name each angle after its own axis,
+// while proper Euler orders store the first, middle and last rotation as yaw, pitch and roll.
+enum class EulerOrder
+{
+  XYZ,
+  XZY,
+  YXZ,
+  YZX,
+  ZXY,
+  ZYX,
+  XYX,
+  XZX,
+  YXY,
+  YZY,
+  ZXZ,
+  ZYZ
+};
+
+// Forward declaration
+template<typename T, EulerOrder Order = EulerOrder::ZYX>
+struct Euler;
+
+template<typename T>
+struct Quaternion;
+
+template<typename T>
+class Angle;
+
+namespace detail
+{
+
+constexpr std::array<int, 3> euler_axes(EulerOrder order)
+{
+  switch (order) {
+    case EulerOrder::XYZ: return {0, 1, 2};
+    case EulerOrder::XZY: return {0, 2, 1};
+    case EulerOrder::YXZ: return {1, 0, 2};
+    case EulerOrder::YZX: return {1, 2, 0};
+    case EulerOrder::ZXY: return {2, 0, 1};
+    case EulerOrder::ZYX: return {2, 1, 0};
+    case EulerOrder::XYX: return {0, 1, 0};
+    case EulerOrder::XZX: return {0, 2, 0};
+    case EulerOrder::YXY: return {1, 0, 1};
+    case EulerOrder::YZY: return {1, 2, 1};
+    case EulerOrder::ZXZ: return {2, 0, 2};
+    default: return {2, 1, 2};
+  }
+}
+
+// One for cyclic permutations of the axes, negative one otherwise.
+constexpr int euler_parity(int i, int j, int k)
+{
+  return (i - j) * (j - k) * (k - i) / 2;
+}
+
+// Axis of the Euler member holding the rotation at the given position, as 0 roll, 1 pitch, 2 yaw.
+template<EulerOrder Order>
+constexpr int euler_member(int position)
+{
+  constexpr auto axes = euler_axes(Order);
+
+  return (axes[0] != axes[2]) ? axes[position] : 2 - position;
+}
+
+template<int Member, typename T, EulerOrder Order>
+Angle<T> & euler_angle(Euler<T, Order> & euler)
+{
+  if constexpr (Member == 0) {
+    return euler.roll;
+  } else if constexpr (Member == 1) {
+    return euler.pitch;
+  } else {
+    return euler.yaw;
+  }
+}
+
+template<int Member, typename T, EulerOrder Order>
+const Angle<T> & euler_angle(const Euler<T, Order> & euler)
+{
+  return euler_angle<Member>(const_cast<Euler<T, Order> &>(euler));
+}
+
+template<int Axis, typename T>
+T & quaternion_axis(Quaternion<T> & quaternion)
+{
+  if constexpr (Axis == 0) {
+    return quaternion.x;
+  } else if constexpr (Axis == 1) {
+    return quaternion.y;
+  } else {
+    return quaternion.z;
+  }
+}
+
+}  // namespace detail
+
+}  // namespace keisan
+
+#endif  // KEISAN__ANGLE__EULER_ORDER_HPP_
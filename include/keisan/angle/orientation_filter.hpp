@@ -0,0 +1,82 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__ORIENTATION_FILTER_HPP_
+#define KEISAN__ANGLE__ORIENTATION_FILTER_HPP_
+
+#include <vector>
+
+#include "keisan/angle/quaternion.hpp"
+#include "keisan/matrix/vector.hpp"
+
+namespace keisan
+{
+
+// Both filters estimate the rotation from the sensor frame to the earth frame, where gyro is the
+// angular velocity in radian per second and acceleration is the accelerometer reading in any unit.
+// The readings are plain vectors, a Point3 converts to them implicitly.
+
+template<typename T>
+class MadgwickFilter
+{
+public:
+  explicit MadgwickFilter(const T & beta = 0.1);
+
+  void update(const Vector<3> & gyro, const Vector<3> & acceleration, const T & dt);
+  void update(
+    const std::vector<Vector<3>> & gyros, const std::vector<Vector<3>> & accelerations, const T & dt,
+    std::vector<Quaternion<T>> & orientations);
+
+  void set_orientation(const Quaternion<T> & orientation);
+  const Quaternion<T> & get_orientation() const;
+
+private:
+  Quaternion<T> orientation;
+  T beta;
+};
+
+template<typename T>
+class MahonyFilter
+{
+public:
+  explicit MahonyFilter(const T & proportional_gain = 1.0, const T & integral_gain = 0.0);
+
+  void update(const Vector<3> & gyro, const Vector<3> & acceleration, const T & dt);
+  void update(
+    const std::vector<Vector<3>> & gyros, const std::vector<Vector<3>> & accelerations, const T & dt,
+    std::vector<Quaternion<T>> & orientations);
+
+  void set_orientation(const Quaternion<T> & orientation);
+  const Quaternion<T> & get_orientation() const;
+
+private:
+  Quaternion<T> orientation;
+  T proportional_gain;
+  T integral_gain;
+  T integral_x;
+  T integral_y;
+  T integral_z;
+};
+
+}  // namespace keisan
+
+#include "keisan/angle/orientation_filter.impl.hpp"
+
+#endif  // KEISAN__ANGLE__ORIENTATION_FILTER_HPP_
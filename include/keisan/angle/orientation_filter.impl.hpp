@@ -0,0 +1,213 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__ORIENTATION_FILTER_IMPL_HPP_
+#define KEISAN__ANGLE__ORIENTATION_FILTER_IMPL_HPP_
+
+#include <cmath>
+#include <stdexcept>
+
+#include "keisan/angle/orientation_filter.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// Integrates q' = q + 0.5 * q * (gx, gy, gz, 0) * dt, then renormalizes the result.
+template<typename T>
+Quaternion<T> integrate_orientation(
+  const Quaternion<T> & q, const T & gx, const T & gy, const T & gz, const T & dt,
+  const T & dx = 0, const T & dy = 0, const T & dz = 0, const T & dw = 0)
+{
+  T half_dt = 0.5 * dt;
+
+  Quaternion<T> result(
+    q.x + (q.w * gx + q.y * gz - q.z * gy) * half_dt + dx * dt,
+    q.y + (q.w * gy - q.x * gz + q.z * gx) * half_dt + dy * dt,
+    q.z + (q.w * gz + q.x * gy - q.y * gx) * half_dt + dz * dt,
+    q.w - (q.x * gx + q.y * gy + q.z * gz) * half_dt + dw * dt);
+
+  T scale = 1 / std::sqrt(result.dot(result));
+
+  return Quaternion<T>(result.x * scale, result.y * scale, result.z * scale, result.w * scale);
+}
+
+template<typename Filter, typename T>
+void replay_orientation(
+  Filter & filter, const std::vector<Vector<3>> & gyros, const std::vector<Vector<3>> & accelerations,
+  const T & dt, std::vector<Quaternion<T>> & orientations)
+{
+  if (gyros.size() != accelerations.size()) {
+    throw std::invalid_argument("gyros and accelerations must have the same size");
+  }
+
+  orientations.resize(gyros.size());
+  for (size_t i = 0; i < gyros.size(); ++i) {
+    filter.update(gyros[i], accelerations[i], dt);
+    orientations[i] = filter.get_orientation();
+  }
+}
+
+}  // namespace detail
+
+template<typename T>
+MadgwickFilter<T>::MadgwickFilter(const T & beta)
+: orientation(Quaternion<T>::identity()), beta(beta)
+{
+}
+
+template<typename T>
+void MadgwickFilter<T>::update(const Vector<3> & gyro, const Vector<3> & acceleration, const T & dt)
+{
+  const auto & q = orientation;
+
+  T gx = gyro[0];
+  T gy = gyro[1];
+  T gz = gyro[2];
+
+  T norm = acceleration[0] * acceleration[0] + acceleration[1] * acceleration[1] +
+    acceleration[2] * acceleration[2];
+  if (norm <= 0) {
+    orientation = detail::integrate_orientation(q, gx, gy, gz, dt);
+    return;
+  }
+
+  T scale = 1 / std::sqrt(norm);
+  T ax = acceleration[0] * scale;
+  T ay = acceleration[1] * scale;
+  T az = acceleration[2] * scale;
+
+  // Difference between the gravity predicted by the orientation and the measured one.
+  T fx = 2 * (q.x * q.z - q.w * q.y) - ax;
+  T fy = 2 * (q.w * q.x + q.y * q.z) - ay;
+  T fz = 1 - 2 * (q.x * q.x + q.y * q.y) - az;
+
+  // Gradient of the squared difference, as the transposed Jacobian multiplied by the difference.
+  T sx = 2 * (q.z * fx + q.w * fy) - 4 * q.x * fz;
+  T sy = 2 * (q.z * fy - q.w * fx) - 4 * q.y * fz;
+  T sz = 2 * (q.x * fx + q.y * fy);
+  T sw = 2 * (q.x * fy - q.y * fx);
+
+  T gradient = sx * sx + sy * sy + sz * sz + sw * sw;
+  T step = (gradient > 0) ? beta / std::sqrt(gradient) : 0;
+
+  orientation = detail::integrate_orientation(
+    q, gx, gy, gz, dt, -sx * step, -sy * step, -sz * step, -sw * step);
+}
+
+template<typename T>
+void MadgwickFilter<T>::update(
+  const std::vector<Vector<3>> & gyros, const std::vector<Vector<3>> & accelerations, const T & dt,
+  std::vector<Quaternion<T>> & orientations)
+{
+  detail::replay_orientation(*this, gyros, accelerations, dt, orientations);
+}
+
+template<typename T>
+void MadgwickFilter<T>::set_orientation(const Quaternion<T> & orientation)
+{
+  this->orientation = orientation;
+}
+
+template<typename T>
+const Quaternion<T> & MadgwickFilter<T>::get_orientation() const
+{
+  return orientation;
+}
+
+template<typename T>
+MahonyFilter<T>::MahonyFilter(const T & proportional_gain, const T & integral_gain)
+: orientation(Quaternion<T>::identity()), proportional_gain(proportional_gain),
+  integral_gain(integral_gain), integral_x(0), integral_y(0), integral_z(0)
+{
+}
+
+template<typename T>
+void MahonyFilter<T>::update(const Vector<3> & gyro, const Vector<3> & acceleration, const T & dt)
+{
+  const auto & q = orientation;
+
+  T gx = gyro[0];
+  T gy = gyro[1];
+  T gz = gyro[2];
+
+  T norm = acceleration[0] * acceleration[0] + acceleration[1] * acceleration[1] +
+    acceleration[2] * acceleration[2];
+  if (norm > 0) {
+    T scale = 1 / std::sqrt(norm);
+    T ax = acceleration[0] * scale;
+    T ay = acceleration[1] * scale;
+    T az = acceleration[2] * scale;
+
+    // Gravity direction predicted by the orientation, in the sensor frame.
+    T vx = 2 * (q.x * q.z - q.w * q.y);
+    T vy = 2 * (q.w * q.x + q.y * q.z);
+    T vz = q.w * q.w - q.x * q.x - q.y * q.y + q.z * q.z;
+
+    T ex = ay * vz - az * vy;
+    T ey = az * vx - ax * vz;
+    T ez = ax * vy - ay * vx;
+
+    if (integral_gain > 0) {
+      integral_x += integral_gain * ex * dt;
+      integral_y += integral_gain * ey * dt;
+      integral_z += integral_gain * ez * dt;
+
+      gx += integral_x;
+      gy += integral_y;
+      gz += integral_z;
+    }
+
+    gx += proportional_gain * ex;
+    gy += proportional_gain * ey;
+    gz += proportional_gain * ez;
+  }
+
+  orientation = detail::integrate_orientation(q, gx, gy, gz, dt);
+}
+
+template<typename T>
+void MahonyFilter<T>::update(
+  const std::vector<Vector<3>> & gyros, const std::vector<Vector<3>> & accelerations, const T & dt,
+  std::vector<Quaternion<T>> & orientations)
+{
+  detail::replay_orientation(*this, gyros, accelerations, dt, orientations);
+}
+
+template<typename T>
+void MahonyFilter<T>::set_orientation(const Quaternion<T> & orientation)
+{
+  this->orientation = orientation;
+  integral_x = 0;
+  integral_y = 0;
+  integral_z = 0;
+}
+
+template<typename T>
+const Quaternion<T> & MahonyFilter<T>::get_orientation() const
+{
+  return orientation;
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__ANGLE__ORIENTATION_FILTER_IMPL_HPP_
@@ -23,13 +23,11 @@
 
 #include <iostream>
 
+#include "keisan/angle/euler_order.hpp"
+
 namespace keisan
 {
 
-// Forward declaration
-template<typename T>
-struct Euler;
-
 template<typename T>
 struct Quaternion
 {
@@ -39,10 +37,27 @@ struct Quaternion
   template<typename U>
   operator Quaternion<U>() const;
 
+  static Quaternion<T> identity();
+
   bool operator==(const Quaternion<T> & other) const;
   bool operator!=(const Quaternion<T> & other) const;
 
-  Euler<T> euler() const;
+  Quaternion<T> & operator*=(const Quaternion<T> & other);
+
+  Quaternion<T> operator*(const Quaternion<T> & other) const;
+
+  Quaternion<T> operator-() const;
+
+  T magnitude() const;
+
+  Quaternion<T> normalize() const;
+  Quaternion<T> conjugate() const;
+  Quaternion<T> inverse() const;
+
+  T dot(const Quaternion<T> & other) const;
+
+  template<EulerOrder Order = EulerOrder::ZYX>
+  Euler<T, Order> euler() const;
 
   T x;
   T y;
@@ -21,6 +21,8 @@
 #ifndef KEISAN__ANGLE__QUATERNION_IMPL_HPP_
 #define KEISAN__ANGLE__QUATERNION_IMPL_HPP_
 
+#include <cmath>
+
 #include "keisan/angle/euler.hpp"
 #include "keisan/constant.hpp"
 
@@ -53,6 +55,12 @@ Quaternion<T>::operator Quaternion<U>() const
   return Quaternion<U>(x, y, z, w);
 }
 
+template<typename T>
+Quaternion<T> Quaternion<T>::identity()
+{
+  return Quaternion<T>(0, 0, 0, 1);
+}
+
 template<typename T>
 bool Quaternion<T>::operator==(const Quaternion<T> & other) const
 {
@@ -66,33 +74,118 @@ bool Quaternion<T>::operator!=(const Quaternion<T> & other) const
 }
 
 template<typename T>
-Euler<T> Quaternion<T>::euler() const
+Quaternion<T> & Quaternion<T>::operator*=(const Quaternion<T> & other)
+{
+  *this = *this * other;
+
+  return *this;
+}
+
+template<typename T>
+Quaternion<T> Quaternion<T>::operator*(const Quaternion<T> & other) const
+{
+  return Quaternion<T>(
+    w * other.x + x * other.w + y * other.z - z * other.y,
+    w * other.y - x * other.z + y * other.w + z * other.x,
+    w * other.z + x * other.y - y * other.x + z * other.w,
+    w * other.w - x * other.x - y * other.y - z * other.z);
+}
+
+template<typename T>
+Quaternion<T> Quaternion<T>::operator-() const
+{
+  return Quaternion<T>(-x, -y, -z, -w);
+}
+
+template<typename T>
+T Quaternion<T>::magnitude() const
+{
+  return std::sqrt(dot(*this));
+}
+
+template<typename T>
+Quaternion<T> Quaternion<T>::normalize() const
 {
-  Euler<T> euler;
+  T scale = 1 / magnitude();
+
+  return Quaternion<T>(x * scale, y * scale, z * scale, w * scale);
+}
 
-  T sqx = x * x;
-  T sqy = y * y;
-  T sqz = z * z;
-  T sqw = w * w;
+template<typename T>
+Quaternion<T> Quaternion<T>::conjugate() const
+{
+  return Quaternion<T>(-x, -y, -z, w);
+}
+
+template<typename T>
+Quaternion<T> Quaternion<T>::inverse() const
+{
+  T scale = 1 / dot(*this);
+
+  return Quaternion<T>(-x * scale, -y * scale, -z * scale, w * scale);
+}
+
+template<typename T>
+T Quaternion<T>::dot(const Quaternion<T> & other) const
+{
+  return x * other.x + y * other.y + z * other.z + w * other.w;
+}
+
+template<typename T>
+template<EulerOrder Order>
+Euler<T, Order> Quaternion<T>::euler() const
+{
+  // Bernardes and Viollet, solved for the extrinsic sequence that equals the reversed intrinsic
+  // order. A Tait-Bryan order is handled as a proper order rotated around its middle axis.
+  constexpr auto axes = detail::euler_axes(Order);
+  constexpr bool is_proper = axes[0] == axes[2];
+  constexpr int i = axes[2];
+  constexpr int j = axes[1];
+  constexpr int k = is_proper ? 3 - i - j : axes[0];
+  constexpr int parity = detail::euler_parity(i, j, k);
+
+  auto quaternion = *this;
+  T qi = detail::quaternion_axis<i>(quaternion);
+  T qj = detail::quaternion_axis<j>(quaternion);
+  T qk = parity * detail::quaternion_axis<k>(quaternion);
+
+  T a = w;
+  T b = qi;
+  T c = qj;
+  T d = qk;
+  if constexpr (!is_proper) {
+    a = w - qj;
+    b = qi + qk;
+    c = qj + w;
+    d = qk - qi;
+  }
+
+  T second = 2 * std::atan2(std::hypot(c, d), std::hypot(a, b));
+  T half_sum = std::atan2(b, a);
+  T half_diff = std::atan2(d, c);
+
+  // On gimbal lock only the sum or difference of the outer angles is defined,
+  // so the last applied rotation is set to zero.
+  constexpr T tolerance = 1e-7;
+  T first = half_sum + half_diff;
+  T third = half_sum - half_diff;
+  if (std::abs(second) < tolerance) {
+    first = 2 * half_sum;
+    third = 0;
+  } else if (std::abs(second - 1_pi) < tolerance) {
+    first = 2 * half_diff;
+    third = 0;
+  }
 
-  T sarg = -2 * (x * z - w * y) / (sqx + sqy + sqz + sqw);
-  if (sarg <= -0.99999) {
-    euler.roll = make_radian(0.0);
-    euler.pitch = make_radian(-0.5_pi);
-    euler.yaw = -2.0 * signed_arctan(y, x);
-  } else if (sarg >= 0.99999) {
-    euler.roll = make_radian(0.0);
-    euler.pitch = make_radian(0.5_pi);
-    euler.yaw = 2.0 * signed_arctan(y, x);
-  } else {
-    euler.roll = signed_arctan(2 * (y * z + w * x), sqw - sqx - sqy + sqz);
-    euler.pitch = arcsin(sarg);
-    euler.yaw = signed_arctan(2 * (x * y + w * z), sqw + sqx - sqy - sqz);
+  if constexpr (!is_proper) {
+    first *= parity;
+    second -= 0.5_pi;
   }
 
-  euler.roll = euler.roll.normalize();
-  euler.pitch = euler.pitch.normalize();
-  euler.yaw = euler.yaw.normalize();
+  Euler<T, Order> euler;
+  detail::euler_angle<detail::euler_member<Order>(0)>(euler) = make_radian(first).normalize();
+  detail::euler_angle<detail::euler_member<Order>(1)>(euler) = make_radian(second).normalize();
+  detail::euler_angle<detail::euler_member<Order>(2)>(euler) = make_radian(third).normalize();
 
   return euler;
 }
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__QUATERNION_AVERAGE_HPP_
+#define KEISAN__ANGLE__QUATERNION_AVERAGE_HPP_
+
+#include "keisan/angle/quaternion.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+// Weighted average of unit quaternions, accumulated incrementally so the samples are not kept.
+class QuaternionAverage
+{
+public:
+  QuaternionAverage();
+
+  void add(const Quaternion<double> & quaternion, double weight = 1.0);
+
+  void merge(const QuaternionAverage & other);
+
+  void reset();
+
+  double total_weight() const;
+
+  // Markley method, the eigenvector with the largest eigenvalue of the sum of weighted outer
+  // products. Unaffected by the sign of each quaternion.
+  Quaternion<double> average() const;
+
+  // Normalized weighted sum with every sample flipped to the hemisphere of the first one.
+  // Only accurate when the samples are close to each other.
+  Quaternion<double> fast_average() const;
+
+private:
+  Matrix<4, 4> accumulator;
+  Quaternion<double> reference;
+  Quaternion<double> sum;
+  double weight_sum;
+};
+
+}  // namespace keisan
+
+#include "keisan/angle/quaternion_average.impl.hpp"
+
+#endif  // KEISAN__ANGLE__QUATERNION_AVERAGE_HPP_
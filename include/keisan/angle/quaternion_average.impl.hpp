@@ -0,0 +1,121 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__QUATERNION_AVERAGE_IMPL_HPP_
+#define KEISAN__ANGLE__QUATERNION_AVERAGE_IMPL_HPP_
+
+#include "keisan/angle/quaternion.hpp"
+#include "keisan/angle/quaternion_average.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+inline QuaternionAverage::QuaternionAverage()
+{
+  reset();
+}
+
+inline void QuaternionAverage::add(const Quaternion<double> & quaternion, double weight)
+{
+  if (weight_sum == 0.0) {
+    reference = quaternion;
+  }
+
+  double q[4] = {quaternion.x, quaternion.y, quaternion.z, quaternion.w};
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = i; j < 4; ++j) {
+      accumulator[i][j] += weight * q[i] * q[j];
+      accumulator[j][i] = accumulator[i][j];
+    }
+  }
+
+  double aligned = (reference.dot(quaternion) < 0.0) ? -weight : weight;
+  sum.x += aligned * quaternion.x;
+  sum.y += aligned * quaternion.y;
+  sum.z += aligned * quaternion.z;
+  sum.w += aligned * quaternion.w;
+
+  weight_sum += weight;
+}
+
+inline void QuaternionAverage::merge(const QuaternionAverage & other)
+{
+  if (other.weight_sum == 0.0) {
+    return;
+  }
+
+  if (weight_sum == 0.0) {
+    reference = other.reference;
+  }
+
+  accumulator += other.accumulator;
+
+  double aligned = (sum.dot(other.sum) < 0.0) ? -1.0 : 1.0;
+  sum.x += aligned * other.sum.x;
+  sum.y += aligned * other.sum.y;
+  sum.z += aligned * other.sum.z;
+  sum.w += aligned * other.sum.w;
+
+  weight_sum += other.weight_sum;
+}
+
+inline void QuaternionAverage::reset()
+{
+  accumulator = Matrix<4, 4>::zero();
+  reference = Quaternion<double>::identity();
+  sum = Quaternion<double>(0.0, 0.0, 0.0, 0.0);
+  weight_sum = 0.0;
+}
+
+inline double QuaternionAverage::total_weight() const
+{
+  return weight_sum;
+}
+
+inline Quaternion<double> QuaternionAverage::average() const
+{
+  if (weight_sum == 0.0) {
+    return Quaternion<double>::identity();
+  }
+
+  Vector<4> eigenvalues;
+  Matrix<4, 4> eigenvectors;
+  accumulator.symmetric_eigen(eigenvalues, eigenvectors);
+
+  Quaternion<double> result(
+    eigenvectors[0][0], eigenvectors[1][0], eigenvectors[2][0], eigenvectors[3][0]);
+
+  // Keep the same hemisphere as the inputs for a predictable sign.
+  return (result.dot(reference) < 0.0) ? -result : result;
+}
+
+inline Quaternion<double> QuaternionAverage::fast_average() const
+{
+  if (sum.dot(sum) == 0.0) {
+    return Quaternion<double>::identity();
+  }
+
+  return sum.normalize();
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__ANGLE__QUATERNION_AVERAGE_IMPL_HPP_
@@ -0,0 +1,85 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__TRIGONOMETRY_HPP_
+#define KEISAN__ANGLE__TRIGONOMETRY_HPP_
+
+#include <utility>
+#include <vector>
+
+#include "keisan/angle/angle.hpp"
+
+namespace keisan
+{
+
+// Maximum absolute error of the polynomial approximations (in radian for the inverse functions),
+// measured in double precision. Low is below 1e-4 and High is below 1e-7.
+enum class Precision
+{
+  Low,
+  High,
+};
+
+template<Precision P = Precision::High, typename T>
+std::pair<IfElseFloat<T, double>, IfElseFloat<T, double>> fast_sincos(const Angle<T> & angle);
+
+template<Precision P = Precision::High, typename T>
+IfElseFloat<T, double> fast_sin(const Angle<T> & angle);
+
+template<Precision P = Precision::High, typename T>
+IfElseFloat<T, double> fast_cos(const Angle<T> & angle);
+
+template<Precision P = Precision::High, typename T>
+Angle<IfElseFloat<T, double>> fast_arcsin(const T & value);
+
+template<Precision P = Precision::High, typename T>
+Angle<IfElseFloat<T, double>> fast_arccos(const T & value);
+
+template<Precision P = Precision::High, typename T>
+Angle<IfElseFloat<T, double>> fast_arctan(const T & value);
+
+template<Precision P = Precision::High, typename T>
+Angle<IfElseFloat<T, double>> fast_signed_arctan(const T & y, const T & x);
+
+template<Precision P = Precision::High, typename T>
+void sincos(
+  const std::vector<Angle<T>> & angles, std::vector<IfElseFloat<T, double>> & sines,
+  std::vector<IfElseFloat<T, double>> & cosines);
+
+template<Precision P = Precision::High, typename T>
+void arcsin(const std::vector<T> & values, std::vector<Angle<IfElseFloat<T, double>>> & angles);
+
+template<Precision P = Precision::High, typename T>
+void arccos(const std::vector<T> & values, std::vector<Angle<IfElseFloat<T, double>>> & angles);
+
+template<Precision P = Precision::High, typename T>
+void signed_arctan(
+  const std::vector<T> & y, const std::vector<T> & x,
+  std::vector<Angle<IfElseFloat<T, double>>> & angles);
+
+// Batch of Point2::direction(), accepts any point type with x and y members.
+template<Precision P = Precision::High, typename Point>
+void direction(const std::vector<Point> & points, std::vector<Angle<double>> & angles);
+
+}  // namespace keisan
+
+#include "keisan/angle/trigonometry.impl.hpp"
+
+#endif  // KEISAN__ANGLE__TRIGONOMETRY_HPP_
@@ -0,0 +1,260 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__ANGLE__TRIGONOMETRY_IMPL_HPP_
+#define KEISAN__ANGLE__TRIGONOMETRY_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "keisan/angle/trigonometry.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// Adding and subtracting 1.5 * 2^(digits - 1) rounds to the nearest integer, unlike std::floor
+// this does not stop the loop from being vectorized.
+template<typename T>
+inline T round_integer(T value)
+{
+  constexpr T magic = static_cast<T>(1.5) *
+    static_cast<T>(1ull << (std::numeric_limits<T>::digits - 1));
+
+  return (value + magic) - magic;
+}
+
+// Reduce the value into [-pi/4, pi/4] around the nearest multiple of pi/2, evaluate the minimax
+// polynomials there, then pick and negate the results based on the quadrant. Every step is
+// branch-free so the batch loop is able to vectorize.
+template<Precision P, typename T>
+inline void sincos_radian(T value, T & sine, T & cosine)
+{
+  // pi/2 split into a 33-bit head and its tail, so k * head is exact for |k| < 2^20.
+  constexpr T two_over_pi = 0.63661977236758134308;
+  constexpr T half_pi_head = 1.57079632673412561417;
+  constexpr T half_pi_tail = 6.07710050650619224932e-11;
+
+  T k = round_integer(value * two_over_pi);
+  T r = (value - k * half_pi_head) - k * half_pi_tail;
+  T r2 = r * r;
+
+  T s;
+  T c;
+  if constexpr (P == Precision::Low) {
+    s = r * (static_cast<T>(0.99999499756164334) + r2 * (static_cast<T>(-0.16660161988235425) +
+      r2 * static_cast<T>(0.0081215579246251401)));
+    c = static_cast<T>(0.99999003495534478) + r2 * (static_cast<T>(-0.49970814035693445) +
+      r2 * static_cast<T>(0.040398535969067763));
+  } else {
+    s = r * (static_cast<T>(0.99999999845885035) + r2 * (static_cast<T>(-0.16666653423645733) +
+      r2 * (static_cast<T>(0.008332084638406274) + r2 * static_cast<T>(-0.00019503948393302016))));
+    c = static_cast<T>(0.99999997242332317) + r2 * (static_cast<T>(-0.49999856695849865) +
+      r2 * (static_cast<T>(0.04165502688429943) + r2 * static_cast<T>(-0.0013585908510622608)));
+  }
+
+  // Quadrant kept as a floating point value in [0, 4), integer conversion does not vectorize.
+  T quadrant = k - 4 * round_integer(k * static_cast<T>(0.25) - static_cast<T>(0.375));
+  bool swap = quadrant == 1 || quadrant == 3;
+  bool negate_sine = quadrant >= 2;
+  bool negate_cosine = quadrant == 1 || quadrant == 2;
+
+  sine = swap ? c : s;
+  cosine = swap ? s : c;
+  sine = negate_sine ? -sine : sine;
+  cosine = negate_cosine ? -cosine : cosine;
+}
+
+// atan(min / max) from the minimax polynomial on [0, 1], then moved into the right octant and
+// quadrant with selects instead of branches.
+template<Precision P, typename T>
+inline T atan2_radian(T y, T x)
+{
+  constexpr T half_pi = 1.57079632679489661923;
+  constexpr T pi = 3.14159265358979323846;
+
+  T abs_y = std::abs(y);
+  T abs_x = std::abs(x);
+  T min = std::min(abs_y, abs_x);
+  T max = std::max(abs_y, abs_x);
+
+  T a = max > 0 ? min / max : 0;
+  T a2 = a * a;
+
+  T r;
+  if constexpr (P == Precision::Low) {
+    r = a * (static_cast<T>(0.99986632946551457) + a2 * (static_cast<T>(-0.3303047854991315) +
+      a2 * (static_cast<T>(0.18015929461651667) + a2 * (static_cast<T>(-0.085156350807747638) +
+      a2 * static_cast<T>(0.020845114164094868)))));
+  } else {
+    r = a * (static_cast<T>(0.99999933557834264) + a2 * (static_cast<T>(-0.33329860784343129) +
+      a2 * (static_cast<T>(0.19946565651467055) + a2 * (static_cast<T>(-0.13908629550968837) +
+      a2 * (static_cast<T>(0.096421973308672651) + a2 * (static_cast<T>(-0.05591232681056324) +
+      a2 * (static_cast<T>(0.021862957904566094) +
+      a2 * static_cast<T>(-0.0040545672217111471))))))));
+  }
+
+  r = abs_y > abs_x ? half_pi - r : r;
+  r = x < 0 ? pi - r : r;
+
+  return y < 0 ? -r : r;
+}
+
+}  // namespace detail
+
+template<Precision P, typename T>
+std::pair<IfElseFloat<T, double>, IfElseFloat<T, double>> fast_sincos(const Angle<T> & angle)
+{
+  using U = IfElseFloat<T, double>;
+
+  U sine;
+  U cosine;
+  detail::sincos_radian<P, U>(Angle<U>(angle).radian(), sine, cosine);
+
+  return {sine, cosine};
+}
+
+template<Precision P, typename T>
+IfElseFloat<T, double> fast_sin(const Angle<T> & angle)
+{
+  return fast_sincos<P>(angle).first;
+}
+
+template<Precision P, typename T>
+IfElseFloat<T, double> fast_cos(const Angle<T> & angle)
+{
+  return fast_sincos<P>(angle).second;
+}
+
+template<Precision P, typename T>
+Angle<IfElseFloat<T, double>> fast_arcsin(const T & value)
+{
+  using U = IfElseFloat<T, double>;
+
+  U sine = value;
+  return make_radian(detail::atan2_radian<P, U>(sine, std::sqrt(1 - sine * sine)));
+}
+
+template<Precision P, typename T>
+Angle<IfElseFloat<T, double>> fast_arccos(const T & value)
+{
+  using U = IfElseFloat<T, double>;
+
+  U cosine = value;
+  return make_radian(detail::atan2_radian<P, U>(std::sqrt(1 - cosine * cosine), cosine));
+}
+
+template<Precision P, typename T>
+Angle<IfElseFloat<T, double>> fast_arctan(const T & value)
+{
+  using U = IfElseFloat<T, double>;
+
+  return make_radian(detail::atan2_radian<P, U>(value, 1));
+}
+
+template<Precision P, typename T>
+Angle<IfElseFloat<T, double>> fast_signed_arctan(const T & y, const T & x)
+{
+  using U = IfElseFloat<T, double>;
+
+  return make_radian(detail::atan2_radian<P, U>(y, x));
+}
+
+template<Precision P, typename T>
+void sincos(
+  const std::vector<Angle<T>> & angles, std::vector<IfElseFloat<T, double>> & sines,
+  std::vector<IfElseFloat<T, double>> & cosines)
+{
+  using U = IfElseFloat<T, double>;
+
+  size_t size = angles.size();
+  sines.resize(size);
+  cosines.resize(size);
+
+  // Unit conversion first, so the polynomial pass runs over plain contiguous values.
+  for (size_t i = 0; i < size; ++i) {
+    sines[i] = Angle<U>(angles[i]).radian();
+  }
+
+  U * sine = sines.data();
+  U * cosine = cosines.data();
+  for (size_t i = 0; i < size; ++i) {
+    detail::sincos_radian<P, U>(sine[i], sine[i], cosine[i]);
+  }
+}
+
+template<Precision P, typename T>
+void arcsin(const std::vector<T> & values, std::vector<Angle<IfElseFloat<T, double>>> & angles)
+{
+  using U = IfElseFloat<T, double>;
+
+  angles.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    U sine = values[i];
+    angles[i] = make_radian(detail::atan2_radian<P, U>(sine, std::sqrt(1 - sine * sine)));
+  }
+}
+
+template<Precision P, typename T>
+void arccos(const std::vector<T> & values, std::vector<Angle<IfElseFloat<T, double>>> & angles)
+{
+  using U = IfElseFloat<T, double>;
+
+  angles.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    U cosine = values[i];
+    angles[i] = make_radian(detail::atan2_radian<P, U>(std::sqrt(1 - cosine * cosine), cosine));
+  }
+}
+
+template<Precision P, typename T>
+void signed_arctan(
+  const std::vector<T> & y, const std::vector<T> & x,
+  std::vector<Angle<IfElseFloat<T, double>>> & angles)
+{
+  using U = IfElseFloat<T, double>;
+
+  if (y.size() != x.size()) {
+    throw std::invalid_argument("y and x must have the same size");
+  }
+
+  angles.resize(y.size());
+  for (size_t i = 0; i < y.size(); ++i) {
+    angles[i] = make_radian(detail::atan2_radian<P, U>(y[i], x[i]));
+  }
+}
+
+template<Precision P, typename Point>
+void direction(const std::vector<Point> & points, std::vector<Angle<double>> & angles)
+{
+  angles.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    angles[i] = make_radian(detail::atan2_radian<P, double>(points[i].y, points[i].x));
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__ANGLE__TRIGONOMETRY_IMPL_HPP_
@@ -0,0 +1,117 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__ALIGNED_VECTOR_HPP_
+#define KEISAN__GEOMETRY__ALIGNED_VECTOR_HPP_
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "keisan/number.hpp"
+
+namespace keisan
+{
+
+template<typename T, size_t Alignment = 64>
+struct AlignedAllocator
+{
+  using value_type = T;
+
+  template<typename U>
+  struct rebind
+  {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  AlignedAllocator() = default;
+
+  template<typename U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment> &)
+  {
+  }
+
+  T * allocate(size_t size)
+  {
+    return static_cast<T *>(::operator new(size * sizeof(T), std::align_val_t(Alignment)));
+  }
+
+  void deallocate(T * pointer, size_t)
+  {
+    ::operator delete(pointer, std::align_val_t(Alignment));
+  }
+
+  template<typename U>
+  bool operator==(const AlignedAllocator<U, Alignment> &) const
+  {
+    return true;
+  }
+
+  template<typename U>
+  bool operator!=(const AlignedAllocator<U, Alignment> &) const
+  {
+    return false;
+  }
+};
+
+// Cache line aligned storage, so bulk loops start on a full vector register.
+template<typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+namespace detail
+{
+
+// Expects a non empty range.
+inline void lane_min_max(const double * values, size_t size, double & min, double & max)
+{
+  double mins[reduction_lanes];
+  double maxs[reduction_lanes];
+  for (size_t lane = 0; lane < reduction_lanes; ++lane) {
+    mins[lane] = values[0];
+    maxs[lane] = values[0];
+  }
+
+  size_t i = 0;
+  for (; i + reduction_lanes <= size; i += reduction_lanes) {
+    for (size_t lane = 0; lane < reduction_lanes; ++lane) {
+      double value = values[i + lane];
+      mins[lane] = (value < mins[lane]) ? value : mins[lane];
+      maxs[lane] = (value > maxs[lane]) ? value : maxs[lane];
+    }
+  }
+
+  for (; i < size; ++i) {
+    mins[0] = (values[i] < mins[0]) ? values[i] : mins[0];
+    maxs[0] = (values[i] > maxs[0]) ? values[i] : maxs[0];
+  }
+
+  min = mins[0];
+  max = maxs[0];
+  for (size_t lane = 1; lane < reduction_lanes; ++lane) {
+    min = (mins[lane] < min) ? mins[lane] : min;
+    max = (maxs[lane] > max) ? maxs[lane] : max;
+  }
+}
+
+}  // namespace detail
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__ALIGNED_VECTOR_HPP_
@@ -0,0 +1,198 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__BOUNDING_BOX_HPP_
+#define KEISAN__GEOMETRY__BOUNDING_BOX_HPP_
+
+#include <vector>
+
+#include "keisan/angle/angle.hpp"
+#include "keisan/angle/quaternion.hpp"
+#include "keisan/geometry/aligned_vector.hpp"
+#include "keisan/geometry/point_2.hpp"
+#include "keisan/geometry/point_3.hpp"
+#include "keisan/geometry/point_cloud_2.hpp"
+#include "keisan/geometry/point_cloud_3.hpp"
+
+namespace keisan
+{
+
+// Axis aligned box, empty() has its min above its max so merging anything into it gives that.
+struct Aabb2
+{
+  Aabb2() = default;
+  constexpr Aabb2(const Point2 & min, const Point2 & max);
+
+  static constexpr Aabb2 empty();
+
+  // Expects a non empty set of points.
+  static Aabb2 from_points(const std::vector<Point2> & points);
+  static Aabb2 from_points(const PointCloud2 & points);
+
+  constexpr bool is_empty() const;
+
+  constexpr Point2 center() const;
+  constexpr Point2 half_extents() const;
+  constexpr double area() const;
+
+  constexpr Aabb2 merge(const Aabb2 & other) const;
+  constexpr Aabb2 merge(const Point2 & point) const;
+  constexpr Aabb2 expand(double margin) const;
+
+  constexpr bool contains(const Point2 & point) const;
+  constexpr bool contains(const Aabb2 & other) const;
+
+  Point2 min;
+  Point2 max;
+};
+
+struct Aabb3
+{
+  Aabb3() = default;
+  constexpr Aabb3(const Point3 & min, const Point3 & max);
+
+  static constexpr Aabb3 empty();
+
+  // Expects a non empty set of points.
+  static Aabb3 from_points(const std::vector<Point3> & points);
+  static Aabb3 from_points(const PointCloud3 & points);
+
+  constexpr bool is_empty() const;
+
+  constexpr Point3 center() const;
+  constexpr Point3 half_extents() const;
+  constexpr double volume() const;
+
+  constexpr Aabb3 merge(const Aabb3 & other) const;
+  constexpr Aabb3 merge(const Point3 & point) const;
+  constexpr Aabb3 expand(double margin) const;
+
+  constexpr bool contains(const Point3 & point) const;
+  constexpr bool contains(const Aabb3 & other) const;
+
+  Point3 min;
+  Point3 max;
+};
+
+// Oriented box, the unit axes are kept instead of the orientation so overlap tests never have to
+// evaluate trigonometric functions or rotate by a quaternion.
+struct Obb2
+{
+  Obb2() = default;
+  Obb2(const Point2 & center, const Point2 & half_extents, const Angle<double> & orientation);
+  explicit Obb2(const Aabb2 & box);
+
+  Aabb2 bounds() const;
+
+  bool contains(const Point2 & point) const;
+
+  Point2 center;
+  Point2 half_extents;
+  Point2 axes[2];
+};
+
+struct Obb3
+{
+  Obb3() = default;
+
+  // Expects a unit quaternion, same as Point3::rotate().
+  Obb3(const Point3 & center, const Point3 & half_extents, const Quaternion<double> & orientation);
+  explicit Obb3(const Aabb3 & box);
+
+  Aabb3 bounds() const;
+
+  bool contains(const Point3 & point) const;
+
+  Point3 center;
+  Point3 half_extents;
+  Point3 axes[3];
+};
+
+namespace detail
+{
+
+// Maps a box to its fields as plain doubles, e.g. min.x, min.y, max.x and max.y for Aabb2.
+template<typename Box>
+struct BoxLayout;
+
+}  // namespace detail
+
+// Structure of arrays storage for many boxes, every field is kept in its own aligned column so
+// the one against many overlap tests read contiguous values.
+template<typename Box>
+class BoxArray
+{
+public:
+  static constexpr size_t field_count = detail::BoxLayout<Box>::field_count;
+
+  BoxArray() = default;
+  explicit BoxArray(const std::vector<Box> & boxes);
+
+  size_t size() const;
+  bool empty() const;
+
+  void reserve(size_t size);
+  void clear();
+
+  void push_back(const Box & box);
+
+  Box operator[](size_t pos) const;
+
+  // Values of a single field for every box, in the order given by BoxLayout.
+  const double * column(size_t field) const;
+
+private:
+  AlignedVector<double> columns[field_count];
+};
+
+using Aabb2Array = BoxArray<Aabb2>;
+using Aabb3Array = BoxArray<Aabb3>;
+using Obb2Array = BoxArray<Obb2>;
+using Obb3Array = BoxArray<Obb3>;
+
+// Boxes that only touch are overlapping.
+constexpr bool overlap(const Aabb2 & a, const Aabb2 & b);
+constexpr bool overlap(const Aabb3 & a, const Aabb3 & b);
+
+// Separating axis tests, over the 4 face axes in 2D and the 6 face and 9 edge axes in 3D.
+bool overlap(const Obb2 & a, const Obb2 & b);
+bool overlap(const Obb3 & a, const Obb3 & b);
+
+bool overlap(const Obb2 & a, const Aabb2 & b);
+bool overlap(const Obb3 & a, const Aabb3 & b);
+
+// Indices of the boxes that overlap the box. The tests run without branches over blocks of 8
+// boxes, only collecting the indices branches. The axis aligned tests compare the contiguous
+// columns directly so a block vectorizes, the oriented ones gather each box and run the scalar
+// separating axis test.
+void overlap(const Aabb2 & box, const Aabb2Array & boxes, std::vector<size_t> & indices);
+void overlap(const Aabb3 & box, const Aabb3Array & boxes, std::vector<size_t> & indices);
+void overlap(const Obb2 & box, const Obb2Array & boxes, std::vector<size_t> & indices);
+void overlap(const Obb3 & box, const Obb3Array & boxes, std::vector<size_t> & indices);
+
+// Indices of the points inside the box, e.g. to keep only a region of interest.
+void contains(const Aabb2 & box, const PointCloud2 & points, std::vector<size_t> & indices);
+void contains(const Aabb3 & box, const PointCloud3 & points, std::vector<size_t> & indices);
+
+}  // namespace keisan
+
+#include "keisan/geometry/bounding_box.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__BOUNDING_BOX_HPP_
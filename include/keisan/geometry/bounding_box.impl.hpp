@@ -0,0 +1,680 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__BOUNDING_BOX_IMPL_HPP_
+#define KEISAN__GEOMETRY__BOUNDING_BOX_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "keisan/geometry/bounding_box.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// Boxes tested per pass of the batch overlap loops, 8 doubles fill an AVX-512 register and two
+// AVX2 ones.
+constexpr size_t overlap_lanes = 8;
+
+// Separating axis test written without early returns, so it can run inside the batch loops.
+inline bool obb_overlap(const Obb2 & a, const Obb2 & b)
+{
+  double ea[2] = {a.half_extents.x, a.half_extents.y};
+  double eb[2] = {b.half_extents.x, b.half_extents.y};
+
+  double r[2][2];
+  double abs_r[2][2];
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 2; ++j) {
+      r[i][j] = a.axes[i].dot(b.axes[j]);
+      abs_r[i][j] = std::abs(r[i][j]);
+    }
+  }
+
+  // Offset between the centers in the frame of a.
+  Point2 offset = b.center - a.center;
+  double t[2] = {offset.dot(a.axes[0]), offset.dot(a.axes[1])};
+
+  bool result = true;
+  for (size_t i = 0; i < 2; ++i) {
+    result &= std::abs(t[i]) <= ea[i] + eb[0] * abs_r[i][0] + eb[1] * abs_r[i][1];
+  }
+
+  for (size_t j = 0; j < 2; ++j) {
+    result &= std::abs(t[0] * r[0][j] + t[1] * r[1][j]) <=
+      ea[0] * abs_r[0][j] + ea[1] * abs_r[1][j] + eb[j];
+  }
+
+  return result;
+}
+
+inline bool obb_overlap(const Obb3 & a, const Obb3 & b)
+{
+  double ea[3] = {a.half_extents.x, a.half_extents.y, a.half_extents.z};
+  double eb[3] = {b.half_extents.x, b.half_extents.y, b.half_extents.z};
+
+  // The epsilon keeps the edge axes from nearly parallel edges, whose cross product vanishes,
+  // from reporting a separation out of rounding errors.
+  double r[3][3];
+  double abs_r[3][3];
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      r[i][j] = a.axes[i].dot(b.axes[j]);
+      abs_r[i][j] = std::abs(r[i][j]) + 1e-12;
+    }
+  }
+
+  Point3 offset = b.center - a.center;
+  double t[3] = {offset.dot(a.axes[0]), offset.dot(a.axes[1]), offset.dot(a.axes[2])};
+
+  bool result = true;
+  for (size_t i = 0; i < 3; ++i) {
+    result &= std::abs(t[i]) <=
+      ea[i] + eb[0] * abs_r[i][0] + eb[1] * abs_r[i][1] + eb[2] * abs_r[i][2];
+  }
+
+  for (size_t j = 0; j < 3; ++j) {
+    result &= std::abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) <=
+      ea[0] * abs_r[0][j] + ea[1] * abs_r[1][j] + ea[2] * abs_r[2][j] + eb[j];
+  }
+
+  // Cross products of the i-th axis of a and the j-th axis of b.
+  for (size_t i = 0; i < 3; ++i) {
+    size_t i1 = (i + 1) % 3;
+    size_t i2 = (i + 2) % 3;
+    for (size_t j = 0; j < 3; ++j) {
+      size_t j1 = (j + 1) % 3;
+      size_t j2 = (j + 2) % 3;
+
+      double ra = ea[i1] * abs_r[i2][j] + ea[i2] * abs_r[i1][j];
+      double rb = eb[j1] * abs_r[i][j2] + eb[j2] * abs_r[i][j1];
+      result &= std::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) <= ra + rb;
+    }
+  }
+
+  return result;
+}
+
+// The test takes the index of a box or point, so it can read the fields straight from the columns.
+template<typename Test>
+void collect_overlaps(size_t size, std::vector<size_t> & indices, Test test)
+{
+  indices.clear();
+
+  size_t i = 0;
+  for (; i + overlap_lanes <= size; i += overlap_lanes) {
+    bool flags[overlap_lanes];
+    for (size_t lane = 0; lane < overlap_lanes; ++lane) {
+      flags[lane] = test(i + lane);
+    }
+
+    for (size_t lane = 0; lane < overlap_lanes; ++lane) {
+      if (flags[lane]) {
+        indices.push_back(i + lane);
+      }
+    }
+  }
+
+  for (; i < size; ++i) {
+    if (test(i)) {
+      indices.push_back(i);
+    }
+  }
+}
+
+template<>
+struct BoxLayout<Aabb2>
+{
+  static constexpr size_t field_count = 4;
+
+  static void store(const Aabb2 & box, double * values)
+  {
+    values[0] = box.min.x;
+    values[1] = box.min.y;
+    values[2] = box.max.x;
+    values[3] = box.max.y;
+  }
+
+  static Aabb2 load(const double * values)
+  {
+    return Aabb2(Point2(values[0], values[1]), Point2(values[2], values[3]));
+  }
+};
+
+template<>
+struct BoxLayout<Aabb3>
+{
+  static constexpr size_t field_count = 6;
+
+  static void store(const Aabb3 & box, double * values)
+  {
+    values[0] = box.min.x;
+    values[1] = box.min.y;
+    values[2] = box.min.z;
+    values[3] = box.max.x;
+    values[4] = box.max.y;
+    values[5] = box.max.z;
+  }
+
+  static Aabb3 load(const double * values)
+  {
+    return Aabb3(Point3(values[0], values[1], values[2]), Point3(values[3], values[4], values[5]));
+  }
+};
+
+// Center, half extents, then the axes.
+template<>
+struct BoxLayout<Obb2>
+{
+  static constexpr size_t field_count = 8;
+
+  static void store(const Obb2 & box, double * values)
+  {
+    const Point2 * points[4] = {&box.center, &box.half_extents, &box.axes[0], &box.axes[1]};
+    for (size_t i = 0; i < 4; ++i) {
+      values[i * 2] = points[i]->x;
+      values[i * 2 + 1] = points[i]->y;
+    }
+  }
+
+  static Obb2 load(const double * values)
+  {
+    Obb2 box;
+    Point2 * points[4] = {&box.center, &box.half_extents, &box.axes[0], &box.axes[1]};
+    for (size_t i = 0; i < 4; ++i) {
+      *points[i] = Point2(values[i * 2], values[i * 2 + 1]);
+    }
+
+    return box;
+  }
+};
+
+template<>
+struct BoxLayout<Obb3>
+{
+  static constexpr size_t field_count = 15;
+
+  static void store(const Obb3 & box, double * values)
+  {
+    const Point3 * points[5] = {
+      &box.center, &box.half_extents, &box.axes[0], &box.axes[1], &box.axes[2]};
+    for (size_t i = 0; i < 5; ++i) {
+      values[i * 3] = points[i]->x;
+      values[i * 3 + 1] = points[i]->y;
+      values[i * 3 + 2] = points[i]->z;
+    }
+  }
+
+  static Obb3 load(const double * values)
+  {
+    Obb3 box;
+    Point3 * points[5] = {
+      &box.center, &box.half_extents, &box.axes[0], &box.axes[1], &box.axes[2]};
+    for (size_t i = 0; i < 5; ++i) {
+      *points[i] = Point3(values[i * 3], values[i * 3 + 1], values[i * 3 + 2]);
+    }
+
+    return box;
+  }
+};
+
+// Gathers the fields of the box at pos from the columns of a BoxArray.
+template<typename Box>
+Box load_box(const double * const * columns, size_t pos)
+{
+  double values[BoxLayout<Box>::field_count];
+  for (size_t field = 0; field < BoxLayout<Box>::field_count; ++field) {
+    values[field] = columns[field][pos];
+  }
+
+  return BoxLayout<Box>::load(values);
+}
+
+template<typename Box, size_t FieldCount>
+void column_pointers(const BoxArray<Box> & boxes, const double * (&columns)[FieldCount])
+{
+  for (size_t field = 0; field < FieldCount; ++field) {
+    columns[field] = boxes.column(field);
+  }
+}
+
+}  // namespace detail
+
+constexpr Aabb2::Aabb2(const Point2 & min, const Point2 & max)
+: min(min),
+  max(max)
+{
+}
+
+constexpr Aabb2 Aabb2::empty()
+{
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+  return Aabb2(Point2(infinity, infinity), Point2(-infinity, -infinity));
+}
+
+inline Aabb2 Aabb2::from_points(const std::vector<Point2> & points)
+{
+  auto box = Aabb2(points.front(), points.front());
+  for (const auto & point : points) {
+    box = box.merge(point);
+  }
+
+  return box;
+}
+
+inline Aabb2 Aabb2::from_points(const PointCloud2 & points)
+{
+  Aabb2 box;
+  points.bounds(box.min, box.max);
+
+  return box;
+}
+
+constexpr bool Aabb2::is_empty() const
+{
+  return min.x > max.x || min.y > max.y;
+}
+
+constexpr Point2 Aabb2::center() const
+{
+  return (min + max) * 0.5;
+}
+
+constexpr Point2 Aabb2::half_extents() const
+{
+  return (max - min) * 0.5;
+}
+
+constexpr double Aabb2::area() const
+{
+  return is_empty() ? 0.0 : (max.x - min.x) * (max.y - min.y);
+}
+
+constexpr Aabb2 Aabb2::merge(const Aabb2 & other) const
+{
+  return Aabb2(
+    Point2(std::min(min.x, other.min.x), std::min(min.y, other.min.y)),
+    Point2(std::max(max.x, other.max.x), std::max(max.y, other.max.y)));
+}
+
+constexpr Aabb2 Aabb2::merge(const Point2 & point) const
+{
+  return merge(Aabb2(point, point));
+}
+
+constexpr Aabb2 Aabb2::expand(double margin) const
+{
+  return Aabb2(min - margin, max + margin);
+}
+
+constexpr bool Aabb2::contains(const Point2 & point) const
+{
+  return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y;
+}
+
+constexpr bool Aabb2::contains(const Aabb2 & other) const
+{
+  return other.min.x >= min.x && other.max.x <= max.x &&
+         other.min.y >= min.y && other.max.y <= max.y;
+}
+
+constexpr Aabb3::Aabb3(const Point3 & min, const Point3 & max)
+: min(min),
+  max(max)
+{
+}
+
+constexpr Aabb3 Aabb3::empty()
+{
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+  return Aabb3(Point3(infinity, infinity, infinity), Point3(-infinity, -infinity, -infinity));
+}
+
+inline Aabb3 Aabb3::from_points(const std::vector<Point3> & points)
+{
+  auto box = Aabb3(points.front(), points.front());
+  for (const auto & point : points) {
+    box = box.merge(point);
+  }
+
+  return box;
+}
+
+inline Aabb3 Aabb3::from_points(const PointCloud3 & points)
+{
+  Aabb3 box;
+  points.bounds(box.min, box.max);
+
+  return box;
+}
+
+constexpr bool Aabb3::is_empty() const
+{
+  return min.x > max.x || min.y > max.y || min.z > max.z;
+}
+
+constexpr Point3 Aabb3::center() const
+{
+  return (min + max) * 0.5;
+}
+
+constexpr Point3 Aabb3::half_extents() const
+{
+  return (max - min) * 0.5;
+}
+
+constexpr double Aabb3::volume() const
+{
+  return is_empty() ? 0.0 : (max.x - min.x) * (max.y - min.y) * (max.z - min.z);
+}
+
+constexpr Aabb3 Aabb3::merge(const Aabb3 & other) const
+{
+  return Aabb3(
+    Point3(
+      std::min(min.x, other.min.x), std::min(min.y, other.min.y), std::min(min.z, other.min.z)),
+    Point3(
+      std::max(max.x, other.max.x), std::max(max.y, other.max.y), std::max(max.z, other.max.z)));
+}
+
+constexpr Aabb3 Aabb3::merge(const Point3 & point) const
+{
+  return merge(Aabb3(point, point));
+}
+
+constexpr Aabb3 Aabb3::expand(double margin) const
+{
+  return Aabb3(min - margin, max + margin);
+}
+
+constexpr bool Aabb3::contains(const Point3 & point) const
+{
+  return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y &&
+         point.z >= min.z && point.z <= max.z;
+}
+
+constexpr bool Aabb3::contains(const Aabb3 & other) const
+{
+  return other.min.x >= min.x && other.max.x <= max.x &&
+         other.min.y >= min.y && other.max.y <= max.y &&
+         other.min.z >= min.z && other.max.z <= max.z;
+}
+
+inline Obb2::Obb2(
+  const Point2 & center, const Point2 & half_extents, const Angle<double> & orientation)
+: center(center),
+  half_extents(half_extents)
+{
+  auto [sin, cos] = orientation.sincos();
+  axes[0] = Point2(cos, sin);
+  axes[1] = Point2(-sin, cos);
+}
+
+inline Obb2::Obb2(const Aabb2 & box)
+: center(box.center()),
+  half_extents(box.half_extents()),
+  axes{Point2(1.0, 0.0), Point2(0.0, 1.0)}
+{
+}
+
+inline Aabb2 Obb2::bounds() const
+{
+  Point2 extents(
+    std::abs(axes[0].x) * half_extents.x + std::abs(axes[1].x) * half_extents.y,
+    std::abs(axes[0].y) * half_extents.x + std::abs(axes[1].y) * half_extents.y);
+
+  return Aabb2(center - extents, center + extents);
+}
+
+inline bool Obb2::contains(const Point2 & point) const
+{
+  Point2 offset = point - center;
+  return std::abs(offset.dot(axes[0])) <= half_extents.x &&
+         std::abs(offset.dot(axes[1])) <= half_extents.y;
+}
+
+inline Obb3::Obb3(
+  const Point3 & center, const Point3 & half_extents, const Quaternion<double> & orientation)
+: center(center),
+  half_extents(half_extents),
+  axes{
+    Point3(1.0, 0.0, 0.0).rotate(orientation),
+    Point3(0.0, 1.0, 0.0).rotate(orientation),
+    Point3(0.0, 0.0, 1.0).rotate(orientation)}
+{
+}
+
+inline Obb3::Obb3(const Aabb3 & box)
+: center(box.center()),
+  half_extents(box.half_extents()),
+  axes{Point3(1.0, 0.0, 0.0), Point3(0.0, 1.0, 0.0), Point3(0.0, 0.0, 1.0)}
+{
+}
+
+inline Aabb3 Obb3::bounds() const
+{
+  Point3 extents(
+    std::abs(axes[0].x) * half_extents.x + std::abs(axes[1].x) * half_extents.y +
+    std::abs(axes[2].x) * half_extents.z,
+    std::abs(axes[0].y) * half_extents.x + std::abs(axes[1].y) * half_extents.y +
+    std::abs(axes[2].y) * half_extents.z,
+    std::abs(axes[0].z) * half_extents.x + std::abs(axes[1].z) * half_extents.y +
+    std::abs(axes[2].z) * half_extents.z);
+
+  return Aabb3(center - extents, center + extents);
+}
+
+inline bool Obb3::contains(const Point3 & point) const
+{
+  Point3 offset = point - center;
+  return std::abs(offset.dot(axes[0])) <= half_extents.x &&
+         std::abs(offset.dot(axes[1])) <= half_extents.y &&
+         std::abs(offset.dot(axes[2])) <= half_extents.z;
+}
+
+constexpr bool overlap(const Aabb2 & a, const Aabb2 & b)
+{
+  return a.min.x <= b.max.x && a.max.x >= b.min.x && a.min.y <= b.max.y && a.max.y >= b.min.y;
+}
+
+constexpr bool overlap(const Aabb3 & a, const Aabb3 & b)
+{
+  return a.min.x <= b.max.x && a.max.x >= b.min.x && a.min.y <= b.max.y && a.max.y >= b.min.y &&
+         a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
+
+inline bool overlap(const Obb2 & a, const Obb2 & b)
+{
+  return detail::obb_overlap(a, b);
+}
+
+inline bool overlap(const Obb3 & a, const Obb3 & b)
+{
+  return detail::obb_overlap(a, b);
+}
+
+inline bool overlap(const Obb2 & a, const Aabb2 & b)
+{
+  return detail::obb_overlap(a, Obb2(b));
+}
+
+inline bool overlap(const Obb3 & a, const Aabb3 & b)
+{
+  return detail::obb_overlap(a, Obb3(b));
+}
+
+template<typename Box>
+BoxArray<Box>::BoxArray(const std::vector<Box> & boxes)
+{
+  reserve(boxes.size());
+  for (const auto & box : boxes) {
+    push_back(box);
+  }
+}
+
+template<typename Box>
+size_t BoxArray<Box>::size() const
+{
+  return columns[0].size();
+}
+
+template<typename Box>
+bool BoxArray<Box>::empty() const
+{
+  return columns[0].empty();
+}
+
+template<typename Box>
+void BoxArray<Box>::reserve(size_t size)
+{
+  for (auto & column : columns) {
+    column.reserve(size);
+  }
+}
+
+template<typename Box>
+void BoxArray<Box>::clear()
+{
+  for (auto & column : columns) {
+    column.clear();
+  }
+}
+
+template<typename Box>
+void BoxArray<Box>::push_back(const Box & box)
+{
+  double values[field_count];
+  detail::BoxLayout<Box>::store(box, values);
+
+  for (size_t field = 0; field < field_count; ++field) {
+    columns[field].push_back(values[field]);
+  }
+}
+
+template<typename Box>
+Box BoxArray<Box>::operator[](size_t pos) const
+{
+  const double * pointers[field_count];
+  detail::column_pointers(*this, pointers);
+
+  return detail::load_box<Box>(pointers, pos);
+}
+
+template<typename Box>
+const double * BoxArray<Box>::column(size_t field) const
+{
+  return columns[field].data();
+}
+
+inline void overlap(const Aabb2 & box, const Aabb2Array & boxes, std::vector<size_t> & indices)
+{
+  const Aabb2 bounds = box;
+
+  const double * min_xs = boxes.column(0);
+  const double * min_ys = boxes.column(1);
+  const double * max_xs = boxes.column(2);
+  const double * max_ys = boxes.column(3);
+
+  detail::collect_overlaps(
+    boxes.size(), indices, [&](size_t i) {
+      return (bounds.min.x <= max_xs[i]) & (bounds.max.x >= min_xs[i]) &
+             (bounds.min.y <= max_ys[i]) & (bounds.max.y >= min_ys[i]);
+    });
+}
+
+inline void overlap(const Aabb3 & box, const Aabb3Array & boxes, std::vector<size_t> & indices)
+{
+  const Aabb3 bounds = box;
+
+  const double * min_xs = boxes.column(0);
+  const double * min_ys = boxes.column(1);
+  const double * min_zs = boxes.column(2);
+  const double * max_xs = boxes.column(3);
+  const double * max_ys = boxes.column(4);
+  const double * max_zs = boxes.column(5);
+
+  detail::collect_overlaps(
+    boxes.size(), indices, [&](size_t i) {
+      return (bounds.min.x <= max_xs[i]) & (bounds.max.x >= min_xs[i]) &
+             (bounds.min.y <= max_ys[i]) & (bounds.max.y >= min_ys[i]) &
+             (bounds.min.z <= max_zs[i]) & (bounds.max.z >= min_zs[i]);
+    });
+}
+
+inline void overlap(const Obb2 & box, const Obb2Array & boxes, std::vector<size_t> & indices)
+{
+  const double * columns[Obb2Array::field_count];
+  detail::column_pointers(boxes, columns);
+
+  detail::collect_overlaps(
+    boxes.size(), indices, [&](size_t i) {
+      return detail::obb_overlap(box, detail::load_box<Obb2>(columns, i));
+    });
+}
+
+inline void overlap(const Obb3 & box, const Obb3Array & boxes, std::vector<size_t> & indices)
+{
+  const double * columns[Obb3Array::field_count];
+  detail::column_pointers(boxes, columns);
+
+  detail::collect_overlaps(
+    boxes.size(), indices, [&](size_t i) {
+      return detail::obb_overlap(box, detail::load_box<Obb3>(columns, i));
+    });
+}
+
+inline void contains(const Aabb2 & box, const PointCloud2 & points, std::vector<size_t> & indices)
+{
+  const Aabb2 bounds = box;
+
+  const double * xs = points.xs().data();
+  const double * ys = points.ys().data();
+
+  detail::collect_overlaps(
+    points.size(), indices, [&](size_t i) {
+      return (xs[i] >= bounds.min.x) & (xs[i] <= bounds.max.x) &
+             (ys[i] >= bounds.min.y) & (ys[i] <= bounds.max.y);
+    });
+}
+
+inline void contains(const Aabb3 & box, const PointCloud3 & points, std::vector<size_t> & indices)
+{
+  const Aabb3 bounds = box;
+
+  const double * xs = points.xs().data();
+  const double * ys = points.ys().data();
+  const double * zs = points.zs().data();
+
+  detail::collect_overlaps(
+    points.size(), indices, [&](size_t i) {
+      return (xs[i] >= bounds.min.x) & (xs[i] <= bounds.max.x) &
+             (ys[i] >= bounds.min.y) & (ys[i] <= bounds.max.y) &
+             (zs[i] >= bounds.min.z) & (zs[i] <= bounds.max.z);
+    });
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__BOUNDING_BOX_IMPL_HPP_
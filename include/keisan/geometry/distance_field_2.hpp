@@ -0,0 +1,95 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__DISTANCE_FIELD_2_HPP_
+#define KEISAN__GEOMETRY__DISTANCE_FIELD_2_HPP_
+
+#include <vector>
+
+#include "keisan/geometry/point_2.hpp"
+#include "keisan/geometry/point_cloud_2.hpp"
+#include "keisan/geometry/primitive_2.hpp"
+
+namespace keisan
+{
+
+// Grid of distances to the closest segment, sampled at the cell centers and clamped to a maximum
+// distance. T is the stored type, integral types quantize the distances in [0, max_distance]
+// to keep the grid small enough to stay in cache.
+template<typename T = float>
+class DistanceField2
+{
+public:
+  DistanceField2(
+    const Point2 & origin, double resolution, size_t width, size_t height, double max_distance);
+
+  // Euclidean distance transform (Felzenszwalb and Huttenlocher) over the cells within one cell of
+  // the segments, carrying along which segment each cell is closest to. The stored value is the
+  // exact distance from the cell center to that segment, after two raster sweeps let every cell
+  // take over a closer segment from its neighbors. Only where many segments crowd together may a
+  // cell keep a farther one, by a fraction of a cell. Rebuilding reuses the previous storage.
+  void build(const std::vector<Segment2> & segments);
+
+  const Point2 & get_origin() const;
+  double get_resolution() const;
+  double get_max_distance() const;
+
+  size_t width() const;
+  size_t height() const;
+
+  double value(size_t x, size_t y) const;
+
+  // Bilinear interpolation between the cell centers, points outside the grid read the border.
+  // Between the centers the interpolation error is up to half a cell diagonal near a segment.
+  double distance(const Point2 & point) const;
+
+  void distances(const std::vector<Point2> & points, std::vector<double> & results) const;
+  void distances(const PointCloud2 & cloud, std::vector<double> & results) const;
+
+private:
+  double interpolate(double x, double y) const;
+
+  void transform_line(size_t size);
+
+  Point2 origin;
+  double resolution;
+  double inverse_resolution;
+  size_t grid_width;
+  size_t grid_height;
+  double max_distance;
+  double quantization;
+
+  std::vector<T> values;
+
+  std::vector<double> squared_distances;
+  std::vector<size_t> nearest_segments;
+  std::vector<double> line_input;
+  std::vector<double> line_output;
+  std::vector<size_t> line_input_segments;
+  std::vector<size_t> line_output_segments;
+  std::vector<double> envelope_bounds;
+  std::vector<size_t> envelope_sites;
+};
+
+}  // namespace keisan
+
+#include "keisan/geometry/distance_field_2.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__DISTANCE_FIELD_2_HPP_
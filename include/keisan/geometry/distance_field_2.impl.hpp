@@ -0,0 +1,396 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__DISTANCE_FIELD_2_IMPL_HPP_
+#define KEISAN__GEOMETRY__DISTANCE_FIELD_2_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "keisan/geometry/distance_field_2.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// Stands for cells without any segment nearby, finite so the envelope math never hits inf - inf.
+constexpr double distance_field_unset = 1e20;
+
+// Cells covering [a, b] on one axis and one more cell on both sides, clamped to the grid.
+inline void distance_field_cell_range(
+  double a, double b, double min, double inverse_resolution, size_t size,
+  size_t & begin, size_t & end)
+{
+  double low = std::floor((std::min(a, b) - min) * inverse_resolution) - 1.0;
+  double high = std::floor((std::max(a, b) - min) * inverse_resolution) + 2.0;
+
+  begin = static_cast<size_t>(std::clamp(low, 0.0, static_cast<double>(size)));
+  end = static_cast<size_t>(std::clamp(high, 0.0, static_cast<double>(size)));
+}
+
+}  // namespace detail
+
+template<typename T>
+DistanceField2<T>::DistanceField2(
+  const Point2 & origin, double resolution, size_t width, size_t height, double max_distance)
+: origin(origin),
+  resolution(resolution),
+  inverse_resolution(1.0 / resolution),
+  grid_width(width),
+  grid_height(height),
+  max_distance(max_distance),
+  quantization(1.0)
+{
+  if (!(resolution > 0.0) || !(max_distance > 0.0) || width == 0 || height == 0) {
+    throw std::invalid_argument("resolution, size and max distance must be positive");
+  }
+
+  if constexpr (std::is_integral<T>::value) {
+    quantization = max_distance / std::numeric_limits<T>::max();
+  }
+
+  values.resize(width * height);
+  squared_distances.resize(width * height);
+  nearest_segments.resize(width * height);
+
+  size_t line_size = std::max(width, height);
+  line_input.resize(line_size);
+  line_output.resize(line_size);
+  line_input_segments.resize(line_size);
+  line_output_segments.resize(line_size);
+  envelope_bounds.resize(line_size + 1);
+  envelope_sites.resize(line_size);
+}
+
+template<typename T>
+void DistanceField2<T>::build(const std::vector<Segment2> & segments)
+{
+  std::fill(squared_distances.begin(), squared_distances.end(), detail::distance_field_unset);
+
+  // Seeds every cell within one cell of a segment with its exact squared distance, in cells.
+  // Each row only visits the cells around the part of the segment within one cell of its center,
+  // so a diagonal segment costs its length instead of its bounding box.
+  double squared_inverse_resolution = inverse_resolution * inverse_resolution;
+  for (size_t index = 0; index < segments.size(); ++index) {
+    const Segment2 & segment = segments[index];
+    Point2 direction = segment.direction();
+
+    size_t begin_y, end_y;
+    detail::distance_field_cell_range(
+      segment.start.y, segment.end.y, origin.y, inverse_resolution, grid_height, begin_y, end_y);
+
+    for (size_t y = begin_y; y < end_y; ++y) {
+      double center_y = origin.y + (y + 0.5) * resolution;
+
+      double low = 0.0;
+      double high = 1.0;
+      if (direction.y != 0.0) {
+        double a = (center_y - resolution - segment.start.y) / direction.y;
+        double b = (center_y + resolution - segment.start.y) / direction.y;
+        low = std::max(low, std::min(a, b));
+        high = std::min(high, std::max(a, b));
+      } else if (std::abs(segment.start.y - center_y) > resolution) {
+        continue;
+      }
+
+      if (low > high) {
+        continue;
+      }
+
+      size_t begin_x, end_x;
+      detail::distance_field_cell_range(
+        segment.start.x + direction.x * low, segment.start.x + direction.x * high, origin.x,
+        inverse_resolution, grid_width, begin_x, end_x);
+
+      for (size_t x = begin_x; x < end_x; ++x) {
+        Point2 center(origin.x + (x + 0.5) * resolution, center_y);
+
+        double distance = squared_distance(segment, center) * squared_inverse_resolution;
+        size_t cell = y * grid_width + x;
+        if (distance <= 1.0 && distance < squared_distances[cell]) {
+          squared_distances[cell] = distance;
+          nearest_segments[cell] = index;
+        }
+      }
+    }
+  }
+
+  // The transform is separable, rows first then columns. Each cell carries along the segment of
+  // the seed that wins the envelope.
+  for (size_t y = 0; y < grid_height; ++y) {
+    double * row = squared_distances.data() + y * grid_width;
+    size_t * row_segments = nearest_segments.data() + y * grid_width;
+
+    std::copy(row, row + grid_width, line_input.begin());
+    std::copy(row_segments, row_segments + grid_width, line_input_segments.begin());
+    transform_line(grid_width);
+    std::copy(line_output.begin(), line_output.begin() + grid_width, row);
+    std::copy(
+      line_output_segments.begin(), line_output_segments.begin() + grid_width, row_segments);
+  }
+
+  for (size_t x = 0; x < grid_width; ++x) {
+    for (size_t y = 0; y < grid_height; ++y) {
+      line_input[y] = squared_distances[y * grid_width + x];
+      line_input_segments[y] = nearest_segments[y * grid_width + x];
+    }
+
+    transform_line(grid_height);
+    for (size_t y = 0; y < grid_height; ++y) {
+      squared_distances[y * grid_width + x] = line_output[y];
+      nearest_segments[y * grid_width + x] = line_output_segments[y];
+    }
+  }
+
+  auto center = [this](size_t x, size_t y) {
+      return Point2(origin.x + (x + 0.5) * resolution, origin.y + (y + 0.5) * resolution);
+    };
+
+  // The envelope only picks the segment, the distance to it is evaluated exactly at the center.
+  for (size_t y = 0; y < grid_height; ++y) {
+    for (size_t x = 0; x < grid_width; ++x) {
+      size_t i = y * grid_width + x;
+      if (squared_distances[i] < detail::distance_field_unset) {
+        squared_distances[i] = squared_distance(segments[nearest_segments[i]], center(x, y));
+      }
+    }
+  }
+
+  // A seed lies up to a cell off its segment, so near the boundaries between segments a slightly
+  // farther one may win the envelope. Raster sweeps hand each cell the segment of a neighbor
+  // whenever that one is closer, which carries the right segment across those boundaries.
+  auto adopt = [&](size_t x, size_t y, size_t neighbor_x, size_t neighbor_y) {
+      if (neighbor_x >= grid_width || neighbor_y >= grid_height) {
+        return;
+      }
+
+      size_t i = y * grid_width + x;
+      size_t neighbor = neighbor_y * grid_width + neighbor_x;
+      if (squared_distances[neighbor] >= detail::distance_field_unset ||
+        nearest_segments[neighbor] == nearest_segments[i])
+      {
+        return;
+      }
+
+      double distance = squared_distance(segments[nearest_segments[neighbor]], center(x, y));
+      if (distance < squared_distances[i]) {
+        squared_distances[i] = distance;
+        nearest_segments[i] = nearest_segments[neighbor];
+      }
+    };
+
+  // Out of range neighbors wrap around to huge indices, which adopt() skips.
+  for (size_t y = 0; y < grid_height; ++y) {
+    for (size_t x = 0; x < grid_width; ++x) {
+      adopt(x, y, x - 1, y);
+      adopt(x, y, x - 1, y - 1);
+      adopt(x, y, x, y - 1);
+      adopt(x, y, x + 1, y - 1);
+    }
+
+    for (size_t x = grid_width; x-- > 0;) {
+      adopt(x, y, x + 1, y);
+    }
+  }
+
+  for (size_t y = grid_height; y-- > 0;) {
+    for (size_t x = grid_width; x-- > 0;) {
+      adopt(x, y, x + 1, y);
+      adopt(x, y, x + 1, y + 1);
+      adopt(x, y, x, y + 1);
+      adopt(x, y, x - 1, y + 1);
+    }
+
+    for (size_t x = 0; x < grid_width; ++x) {
+      adopt(x, y, x - 1, y);
+    }
+  }
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    double distance = std::min(std::sqrt(squared_distances[i]), max_distance);
+    if constexpr (std::is_integral<T>::value) {
+      values[i] = static_cast<T>(std::lround(distance / quantization));
+    } else {
+      values[i] = static_cast<T>(distance);
+    }
+  }
+}
+
+template<typename T>
+const Point2 & DistanceField2<T>::get_origin() const
+{
+  return origin;
+}
+
+template<typename T>
+double DistanceField2<T>::get_resolution() const
+{
+  return resolution;
+}
+
+template<typename T>
+double DistanceField2<T>::get_max_distance() const
+{
+  return max_distance;
+}
+
+template<typename T>
+size_t DistanceField2<T>::width() const
+{
+  return grid_width;
+}
+
+template<typename T>
+size_t DistanceField2<T>::height() const
+{
+  return grid_height;
+}
+
+template<typename T>
+double DistanceField2<T>::value(size_t x, size_t y) const
+{
+  return values[y * grid_width + x] * quantization;
+}
+
+template<typename T>
+double DistanceField2<T>::distance(const Point2 & point) const
+{
+  return interpolate(point.x, point.y);
+}
+
+template<typename T>
+void DistanceField2<T>::distances(
+  const std::vector<Point2> & points, std::vector<double> & results) const
+{
+  results.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    results[i] = interpolate(points[i].x, points[i].y);
+  }
+}
+
+template<typename T>
+void DistanceField2<T>::distances(const PointCloud2 & cloud, std::vector<double> & results) const
+{
+  results.resize(cloud.size());
+
+  const double * xs = cloud.xs().data();
+  const double * ys = cloud.ys().data();
+  for (size_t i = 0; i < cloud.size(); ++i) {
+    results[i] = interpolate(xs[i], ys[i]);
+  }
+}
+
+template<typename T>
+double DistanceField2<T>::interpolate(double x, double y) const
+{
+  double grid_x = std::clamp(
+    (x - origin.x) * inverse_resolution - 0.5, 0.0, static_cast<double>(grid_width - 1));
+  double grid_y = std::clamp(
+    (y - origin.y) * inverse_resolution - 0.5, 0.0, static_cast<double>(grid_height - 1));
+
+  // The lower corner stays one cell away from the last one, so both neighbors exist.
+  size_t x0 = std::min(static_cast<size_t>(grid_x), grid_width > 1 ? grid_width - 2 : 0);
+  size_t y0 = std::min(static_cast<size_t>(grid_y), grid_height > 1 ? grid_height - 2 : 0);
+  size_t x_step = grid_width > 1 ? 1 : 0;
+  size_t y_step = grid_height > 1 ? grid_width : 0;
+
+  double fx = grid_x - x0;
+  double fy = grid_y - y0;
+
+  const T * corner = values.data() + y0 * grid_width + x0;
+  double bottom_left = corner[0];
+  double bottom_right = corner[x_step];
+  double top_left = corner[y_step];
+  double top_right = corner[y_step + x_step];
+
+  double bottom = bottom_left + (bottom_right - bottom_left) * fx;
+  double top = top_left + (top_right - top_left) * fx;
+
+  return (bottom + (top - bottom) * fy) * quantization;
+}
+
+template<typename T>
+void DistanceField2<T>::transform_line(size_t size)
+{
+  // Lower envelope of the parabolas rooted at every seeded site.
+  const double * f = line_input.data();
+  double * bounds = envelope_bounds.data();
+  size_t * sites = envelope_sites.data();
+
+  size_t count = 0;
+  for (size_t q = 0; q < size; ++q) {
+    if (f[q] >= detail::distance_field_unset) {
+      continue;
+    }
+
+    double value = f[q] + static_cast<double>(q * q);
+    if (count == 0) {
+      sites[0] = q;
+      bounds[0] = -std::numeric_limits<double>::infinity();
+      bounds[1] = std::numeric_limits<double>::infinity();
+      count = 1;
+      continue;
+    }
+
+    double intersection;
+    while (true) {
+      size_t site = sites[count - 1];
+      intersection = (value - (f[site] + static_cast<double>(site * site))) /
+        (2.0 * (static_cast<double>(q) - static_cast<double>(site)));
+
+      if (intersection > bounds[count - 1]) {
+        break;
+      }
+
+      --count;
+    }
+
+    sites[count] = q;
+    bounds[count] = intersection;
+    bounds[count + 1] = std::numeric_limits<double>::infinity();
+    ++count;
+  }
+
+  if (count == 0) {
+    std::fill(line_output.begin(), line_output.begin() + size, detail::distance_field_unset);
+    return;
+  }
+
+  size_t k = 0;
+  for (size_t q = 0; q < size; ++q) {
+    while (bounds[k + 1] < static_cast<double>(q)) {
+      ++k;
+    }
+
+    double offset = static_cast<double>(q) - static_cast<double>(sites[k]);
+    line_output[q] = offset * offset + f[sites[k]];
+    line_output_segments[q] = line_input_segments[sites[k]];
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__DISTANCE_FIELD_2_IMPL_HPP_
@@ -0,0 +1,89 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__DUAL_QUATERNION_HPP_
+#define KEISAN__GEOMETRY__DUAL_QUATERNION_HPP_
+
+#include <iostream>
+#include <vector>
+
+#include "keisan/angle/quaternion.hpp"
+#include "keisan/geometry/point_3.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+// Rigid transform stored as real + epsilon * dual, where real is the rotation and
+// dual is half of the translation multiplied by the rotation. Composes like Matrix<4, 4>,
+// so a * b applies b first.
+template<typename T>
+struct DualQuaternion
+{
+  DualQuaternion();
+  DualQuaternion(const Quaternion<T> & real, const Quaternion<T> & dual);
+  DualQuaternion(const Quaternion<T> & rotation, const Point3 & translation);
+  explicit DualQuaternion(const Matrix<4, 4> & matrix);
+
+  template<typename U>
+  operator DualQuaternion<U>() const;
+
+  static DualQuaternion<T> identity();
+
+  bool operator==(const DualQuaternion<T> & other) const;
+  bool operator!=(const DualQuaternion<T> & other) const;
+
+  DualQuaternion<T> & operator*=(const DualQuaternion<T> & other);
+
+  DualQuaternion<T> operator*(const DualQuaternion<T> & other) const;
+
+  DualQuaternion<T> normalize() const;
+  DualQuaternion<T> conjugate() const;
+  DualQuaternion<T> inverse() const;
+
+  Quaternion<T> rotation() const;
+  Point3 translation() const;
+
+  Point3 transform(const Point3 & point) const;
+
+  Matrix<4, 4> matrix() const;
+
+  Quaternion<T> real;
+  Quaternion<T> dual;
+};
+
+// Screw linear interpolation, moves along the constant screw motion between two unit transforms.
+template<typename T>
+DualQuaternion<T> sclerp(
+  const DualQuaternion<T> & from, const DualQuaternion<T> & to, const T & t);
+
+template<typename T>
+void sclerp(
+  const DualQuaternion<T> & from, const DualQuaternion<T> & to, const std::vector<T> & ts,
+  std::vector<DualQuaternion<T>> & results);
+
+}  // namespace keisan
+
+template<typename T>
+std::ostream & operator<<(std::ostream & out, const keisan::DualQuaternion<T> & dual_quaternion);
+
+#include "keisan/geometry/dual_quaternion.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__DUAL_QUATERNION_HPP_
@@ -0,0 +1,277 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__DUAL_QUATERNION_IMPL_HPP_
+#define KEISAN__GEOMETRY__DUAL_QUATERNION_IMPL_HPP_
+
+#include <cmath>
+
+#include "keisan/geometry/dual_quaternion.hpp"
+
+template<typename T>
+std::ostream & operator<<(std::ostream & out, const keisan::DualQuaternion<T> & dual_quaternion)
+{
+  return out << dual_quaternion.real << " " << dual_quaternion.dual;
+}
+
+namespace keisan
+{
+
+namespace detail
+{
+
+template<typename T>
+Quaternion<T> scale_quaternion(const Quaternion<T> & quaternion, const T & scale)
+{
+  return Quaternion<T>(
+    quaternion.x * scale, quaternion.y * scale, quaternion.z * scale, quaternion.w * scale);
+}
+
+template<typename T>
+Quaternion<T> add_quaternion(const Quaternion<T> & a, const Quaternion<T> & b)
+{
+  return Quaternion<T>(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+}
+
+// Screw parameters of the relative motion between two transforms, precomputed once so
+// each interpolation step only evaluates one sine and cosine pair.
+template<typename T>
+struct ScrewArc
+{
+  ScrewArc(const DualQuaternion<T> & from, const DualQuaternion<T> & to)
+  : from(from), is_translation(false)
+  {
+    DualQuaternion<T> difference = from.conjugate() * to;
+    if (difference.real.w < 0) {
+      difference.real = -difference.real;
+      difference.dual = -difference.dual;
+    }
+
+    const auto & real = difference.real;
+    const auto & dual = difference.dual;
+
+    T half_sine = std::sqrt(real.x * real.x + real.y * real.y + real.z * real.z);
+    angle = 2 * std::atan2(half_sine, real.w);
+
+    if (half_sine < 1e-9) {
+      is_translation = true;
+      moment = dual;
+      return;
+    }
+
+    T inverse_sine = 1 / half_sine;
+    axis = scale_quaternion(real, inverse_sine);
+    axis.w = 0;
+
+    pitch = -2 * dual.w * inverse_sine;
+
+    T half_pitch_cosine = 0.5 * pitch * real.w;
+    moment = Quaternion<T>(
+      (dual.x - axis.x * half_pitch_cosine) * inverse_sine,
+      (dual.y - axis.y * half_pitch_cosine) * inverse_sine,
+      (dual.z - axis.z * half_pitch_cosine) * inverse_sine, 0);
+  }
+
+  DualQuaternion<T> operator()(const T & t) const
+  {
+    if (is_translation) {
+      Quaternion<T> dual = scale_quaternion(moment, t);
+      dual.w = 0;
+
+      return from * DualQuaternion<T>(Quaternion<T>::identity(), dual);
+    }
+
+    T half_angle = 0.5 * t * angle;
+    T sine = std::sin(half_angle);
+    T cosine = std::cos(half_angle);
+    T half_pitch = 0.5 * t * pitch;
+
+    Quaternion<T> real = scale_quaternion(axis, sine);
+    real.w = cosine;
+
+    Quaternion<T> dual = add_quaternion(
+      scale_quaternion(moment, sine), scale_quaternion(axis, half_pitch * cosine));
+    dual.w = -half_pitch * sine;
+
+    return from * DualQuaternion<T>(real, dual);
+  }
+
+  DualQuaternion<T> from;
+  Quaternion<T> axis;
+  Quaternion<T> moment;
+  T angle;
+  T pitch;
+  bool is_translation;
+};
+
+}  // namespace detail
+
+template<typename T>
+DualQuaternion<T>::DualQuaternion()
+{
+}
+
+template<typename T>
+DualQuaternion<T>::DualQuaternion(const Quaternion<T> & real, const Quaternion<T> & dual)
+: real(real), dual(dual)
+{
+}
+
+template<typename T>
+DualQuaternion<T>::DualQuaternion(const Quaternion<T> & rotation, const Point3 & translation)
+: real(rotation),
+  dual(detail::scale_quaternion(Quaternion<T>(translation.x, translation.y, translation.z, 0) *
+    rotation, T(0.5)))
+{
+}
+
+template<typename T>
+DualQuaternion<T>::DualQuaternion(const Matrix<4, 4> & matrix)
+: DualQuaternion(
+    Quaternion<T>(rotation_quaternion(matrix)),
+    Point3(matrix[0][3], matrix[1][3], matrix[2][3]))
+{
+}
+
+template<typename T>
+template<typename U>
+DualQuaternion<T>::operator DualQuaternion<U>() const
+{
+  return DualQuaternion<U>(real, dual);
+}
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::identity()
+{
+  return DualQuaternion<T>(Quaternion<T>::identity(), Quaternion<T>(0, 0, 0, 0));
+}
+
+template<typename T>
+bool DualQuaternion<T>::operator==(const DualQuaternion<T> & other) const
+{
+  return real == other.real && dual == other.dual;
+}
+
+template<typename T>
+bool DualQuaternion<T>::operator!=(const DualQuaternion<T> & other) const
+{
+  return real != other.real || dual != other.dual;
+}
+
+template<typename T>
+DualQuaternion<T> & DualQuaternion<T>::operator*=(const DualQuaternion<T> & other)
+{
+  *this = *this * other;
+
+  return *this;
+}
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::operator*(const DualQuaternion<T> & other) const
+{
+  return DualQuaternion<T>(
+    real * other.real, detail::add_quaternion(real * other.dual, dual * other.real));
+}
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::normalize() const
+{
+  T scale = 1 / real.magnitude();
+
+  Quaternion<T> unit_real = detail::scale_quaternion(real, scale);
+  Quaternion<T> unit_dual = detail::scale_quaternion(dual, scale);
+
+  // Remove the part of dual along real, so the result stays a rigid transform.
+  unit_dual = detail::add_quaternion(
+    unit_dual, detail::scale_quaternion(unit_real, -unit_real.dot(unit_dual)));
+
+  return DualQuaternion<T>(unit_real, unit_dual);
+}
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::conjugate() const
+{
+  return DualQuaternion<T>(real.conjugate(), dual.conjugate());
+}
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::inverse() const
+{
+  Quaternion<T> real_inverse = real.inverse();
+
+  return DualQuaternion<T>(real_inverse, -(real_inverse * dual * real_inverse));
+}
+
+template<typename T>
+Quaternion<T> DualQuaternion<T>::rotation() const
+{
+  return real;
+}
+
+template<typename T>
+Point3 DualQuaternion<T>::translation() const
+{
+  Quaternion<T> translation = dual * real.conjugate();
+
+  return Point3(2 * translation.x, 2 * translation.y, 2 * translation.z);
+}
+
+template<typename T>
+Point3 DualQuaternion<T>::transform(const Point3 & point) const
+{
+  return point.rotate(Quaternion<double>(real)) + translation();
+}
+
+template<typename T>
+Matrix<4, 4> DualQuaternion<T>::matrix() const
+{
+  auto matrix = rotation_matrix(Quaternion<double>(real));
+  auto translation = this->translation();
+
+  matrix[0][3] = translation.x;
+  matrix[1][3] = translation.y;
+  matrix[2][3] = translation.z;
+
+  return matrix;
+}
+
+template<typename T>
+DualQuaternion<T> sclerp(
+  const DualQuaternion<T> & from, const DualQuaternion<T> & to, const T & t)
+{
+  return detail::ScrewArc<T>(from, to)(t);
+}
+
+template<typename T>
+void sclerp(
+  const DualQuaternion<T> & from, const DualQuaternion<T> & to, const std::vector<T> & ts,
+  std::vector<DualQuaternion<T>> & results)
+{
+  detail::ScrewArc<T> arc(from, to);
+
+  results.resize(ts.size());
+  for (size_t i = 0; i < ts.size(); ++i) {
+    results[i] = arc(ts[i]);
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__DUAL_QUATERNION_IMPL_HPP_
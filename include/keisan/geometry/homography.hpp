@@ -0,0 +1,51 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef KEISAN__GEOMETRY__HOMOGRAPHY_HPP_
+#define KEISAN__GEOMETRY__HOMOGRAPHY_HPP_
+
+#include <vector>
+
+#include "keisan/geometry/point_2.hpp"
+#include "keisan/geometry/point_cloud_2.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+// Direct linear transform over normalized correspondences, the result maps sources onto targets
+// and is scaled so its last element is one. False for degenerate configurations.
+bool find_homography(
+  const std::vector<Point2> & sources, const std::vector<Point2> & targets,
+  Matrix<3, 3> & homography);
+
+Point2 apply_homography(const Matrix<3, 3> & homography, const Point2 & point);
+
+void apply_homography(
+  const Matrix<3, 3> & homography, const std::vector<Point2> & points,
+  std::vector<Point2> & results);
+
+void apply_homography(
+  const Matrix<3, 3> & homography, const PointCloud2 & points, PointCloud2 & results);
+
+}  // namespace keisan
+
+#include "keisan/geometry/homography.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__HOMOGRAPHY_HPP_
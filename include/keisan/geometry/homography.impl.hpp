@@ -0,0 +1,199 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef KEISAN__GEOMETRY__HOMOGRAPHY_IMPL_HPP_
+#define KEISAN__GEOMETRY__HOMOGRAPHY_IMPL_HPP_
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "keisan/geometry/homography.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// Similarity moving the centroid to the origin with an average distance of sqrt(2) from it.
+inline bool normalization_matrix(const std::vector<Point2> & points, Matrix<3, 3> & matrix)
+{
+  double cx = 0.0;
+  double cy = 0.0;
+  for (const auto & point : points) {
+    cx += point.x;
+    cy += point.y;
+  }
+
+  cx /= points.size();
+  cy /= points.size();
+
+  double distance = 0.0;
+  for (const auto & point : points) {
+    distance += std::hypot(point.x - cx, point.y - cy);
+  }
+
+  distance /= points.size();
+  if (distance == 0.0) {
+    return false;
+  }
+
+  double scale = std::sqrt(2.0) / distance;
+  matrix = Matrix<3, 3>(
+    scale, 0.0, -scale * cx,
+    0.0, scale, -scale * cy,
+    0.0, 0.0, 1.0);
+
+  return true;
+}
+
+}  // namespace detail
+
+inline bool find_homography(
+  const std::vector<Point2> & sources, const std::vector<Point2> & targets,
+  Matrix<3, 3> & homography)
+{
+  if (sources.size() != targets.size()) {
+    throw std::invalid_argument("sources and targets must have the same size");
+  }
+
+  if (sources.size() < 4) {
+    throw std::invalid_argument("at least 4 correspondences are required");
+  }
+
+  Matrix<3, 3> source_normalization;
+  Matrix<3, 3> target_normalization;
+  if (!detail::normalization_matrix(sources, source_normalization) ||
+    !detail::normalization_matrix(targets, target_normalization))
+  {
+    return false;
+  }
+
+  // The right singular vector of the 2n x 9 system with the smallest singular value is the
+  // eigenvector of its 9 x 9 normal matrix with the smallest eigenvalue.
+  auto normal = Matrix<9, 9>::zero();
+  for (size_t i = 0; i < sources.size(); ++i) {
+    auto source = apply_homography(source_normalization, sources[i]);
+    auto target = apply_homography(target_normalization, targets[i]);
+
+    double rows[2][9] = {
+      {-source.x, -source.y, -1.0, 0.0, 0.0, 0.0,
+        target.x * source.x, target.x * source.y, target.x},
+      {0.0, 0.0, 0.0, -source.x, -source.y, -1.0,
+        target.y * source.x, target.y * source.y, target.y},
+    };
+
+    for (const auto & row : rows) {
+      for (size_t j = 0; j < 9; ++j) {
+        for (size_t k = j; k < 9; ++k) {
+          normal[j][k] += row[j] * row[k];
+        }
+      }
+    }
+  }
+
+  for (size_t j = 0; j < 9; ++j) {
+    for (size_t k = 0; k < j; ++k) {
+      normal[j][k] = normal[k][j];
+    }
+  }
+
+  Vector<9> eigenvalues;
+  Matrix<9, 9> eigenvectors;
+  normal.symmetric_eigen(eigenvalues, eigenvectors);
+
+  // A second vanishing singular value means the correspondences do not pin down a single map.
+  if (eigenvalues[7] <= 1e-12 * eigenvalues[0]) {
+    return false;
+  }
+
+  Matrix<3, 3> normalized;
+  for (size_t j = 0; j < 9; ++j) {
+    normalized[j / 3][j % 3] = eigenvectors[j][8];
+  }
+
+  if (!target_normalization.inverse3()) {
+    return false;
+  }
+
+  homography = target_normalization * normalized * source_normalization;
+  if (homography[2][2] == 0.0) {
+    return false;
+  }
+
+  homography = homography / homography[2][2];
+
+  return true;
+}
+
+inline Point2 apply_homography(const Matrix<3, 3> & homography, const Point2 & point)
+{
+  const auto & h = homography;
+  double w = 1.0 / (h[2][0] * point.x + h[2][1] * point.y + h[2][2]);
+
+  return Point2(
+    (h[0][0] * point.x + h[0][1] * point.y + h[0][2]) * w,
+    (h[1][0] * point.x + h[1][1] * point.y + h[1][2]) * w);
+}
+
+inline void apply_homography(
+  const Matrix<3, 3> & homography, const std::vector<Point2> & points,
+  std::vector<Point2> & results)
+{
+  results.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    results[i] = apply_homography(homography, points[i]);
+  }
+}
+
+inline void apply_homography(
+  const Matrix<3, 3> & homography, const PointCloud2 & points, PointCloud2 & results)
+{
+  const double h00 = homography[0][0];
+  const double h01 = homography[0][1];
+  const double h02 = homography[0][2];
+  const double h10 = homography[1][0];
+  const double h11 = homography[1][1];
+  const double h12 = homography[1][2];
+  const double h20 = homography[2][0];
+  const double h21 = homography[2][1];
+  const double h22 = homography[2][2];
+
+  results.resize(points.size());
+
+  const double * xs = points.xs().data();
+  const double * ys = points.ys().data();
+  double * result_xs = results.x_data();
+  double * result_ys = results.y_data();
+
+  // Every point is read before it is written, so results may be the input cloud itself.
+  for (size_t i = 0; i < points.size(); ++i) {
+    double x = xs[i];
+    double y = ys[i];
+    double w = 1.0 / (h20 * x + h21 * y + h22);
+
+    result_xs[i] = (h00 * x + h01 * y + h02) * w;
+    result_ys[i] = (h10 * x + h11 * y + h12) * w;
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__HOMOGRAPHY_IMPL_HPP_
@@ -0,0 +1,105 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__ICP_2_HPP_
+#define KEISAN__GEOMETRY__ICP_2_HPP_
+
+#include <vector>
+
+#include "keisan/angle/angle.hpp"
+#include "keisan/geometry/kd_tree.hpp"
+#include "keisan/geometry/point_2.hpp"
+#include "keisan/geometry/pose_2.hpp"
+
+namespace keisan
+{
+
+enum class IcpMethod
+{
+  PointToPoint,
+  PointToLine,
+};
+
+// Iterative closest point alignment of a source scan to a fixed target, with the correspondences
+// found through a KdTree over the target. Buffers are kept between alignments, so aligning
+// scans of a similar size does not allocate.
+class Icp2
+{
+public:
+  explicit Icp2(IcpMethod method = IcpMethod::PointToPoint);
+
+  // Point to line needs the target normals, estimated from the closest neighbors when not given.
+  void set_target(const std::vector<Point2> & points);
+  void set_target(const std::vector<Point2> & points, const std::vector<Point2> & normals);
+
+  void set_max_iterations(size_t iterations);
+  void set_max_correspondence_distance(double distance);
+  void set_tolerance(double translation, const Angle<double> & rotation);
+
+  // Skips the next iteration when it would run past the limit, judging by the previous one, so
+  // at least one iteration always runs.
+  // Zero disables the limit.
+  void set_time_limit(double seconds);
+
+  // Refines the pose that maps the source onto the target, starting from its given value.
+  // Returns true when the update falls within the tolerance before running out of iterations.
+  bool align(const std::vector<Point2> & source, Pose2 & pose);
+
+  size_t get_iterations() const;
+  size_t get_correspondence_count() const;
+  double get_mean_squared_error() const;
+
+  // Duration of every iteration of the last alignment, in seconds.
+  const std::vector<double> & get_iteration_times() const;
+
+private:
+  void find_correspondences();
+
+  bool point_to_point_step(Pose2 & step) const;
+  bool point_to_line_step(Pose2 & step) const;
+
+  IcpMethod method;
+  size_t max_iterations;
+  double squared_max_distance;
+  double translation_tolerance;
+  double rotation_tolerance;
+  double time_limit;
+
+  std::vector<Point2> target_points;
+  std::vector<Point2> target_normals;
+  KdTree<Point2> tree;
+
+  std::vector<Point2> transformed;
+  std::vector<size_t> source_matches;
+  std::vector<size_t> target_matches;
+
+  std::vector<size_t> neighbor_indices;
+  std::vector<double> neighbor_distances;
+
+  size_t iterations;
+  double mean_squared_error;
+  std::vector<double> iteration_times;
+};
+
+}  // namespace keisan
+
+#include "keisan/geometry/icp_2.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__ICP_2_HPP_
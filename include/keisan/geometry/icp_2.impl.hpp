@@ -0,0 +1,288 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__ICP_2_IMPL_HPP_
+#define KEISAN__GEOMETRY__ICP_2_IMPL_HPP_
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "keisan/geometry/icp_2.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+inline Icp2::Icp2(IcpMethod method)
+: method(method),
+  max_iterations(30),
+  squared_max_distance(std::numeric_limits<double>::infinity()),
+  translation_tolerance(1e-4),
+  rotation_tolerance(1e-4),
+  time_limit(0.0),
+  iterations(0),
+  mean_squared_error(0.0)
+{
+}
+
+inline void Icp2::set_target(const std::vector<Point2> & points)
+{
+  target_points = points;
+  tree.build(target_points);
+
+  target_normals.clear();
+  if (method != IcpMethod::PointToLine) {
+    return;
+  }
+
+  target_normals.resize(target_points.size());
+
+  // Normal of the principal axis through the closest neighbors.
+  constexpr size_t neighbor_count = 5;
+  for (size_t i = 0; i < target_points.size(); ++i) {
+    tree.nearest(target_points[i], neighbor_count, neighbor_indices, neighbor_distances);
+
+    Point2 mean(0.0, 0.0);
+    for (auto index : neighbor_indices) {
+      mean += target_points[index];
+    }
+
+    mean /= neighbor_indices.size();
+
+    double xx = 0.0;
+    double xy = 0.0;
+    double yy = 0.0;
+    for (auto index : neighbor_indices) {
+      Point2 offset = target_points[index] - mean;
+      xx += offset.x * offset.x;
+      xy += offset.x * offset.y;
+      yy += offset.y * offset.y;
+    }
+
+    double angle = 0.5 * std::atan2(2.0 * xy, xx - yy);
+    target_normals[i] = Point2(-std::sin(angle), std::cos(angle));
+  }
+}
+
+inline void Icp2::set_target(
+  const std::vector<Point2> & points, const std::vector<Point2> & normals)
+{
+  if (points.size() != normals.size()) {
+    throw std::invalid_argument("points and normals must have the same size");
+  }
+
+  target_points = points;
+  target_normals = normals;
+  tree.build(target_points);
+}
+
+inline void Icp2::set_max_iterations(size_t iterations)
+{
+  max_iterations = iterations;
+}
+
+inline void Icp2::set_max_correspondence_distance(double distance)
+{
+  squared_max_distance = distance * distance;
+}
+
+inline void Icp2::set_tolerance(double translation, const Angle<double> & rotation)
+{
+  translation_tolerance = translation;
+  rotation_tolerance = std::abs(rotation.radian());
+}
+
+inline void Icp2::set_time_limit(double seconds)
+{
+  time_limit = seconds;
+}
+
+inline bool Icp2::align(const std::vector<Point2> & source, Pose2 & pose)
+{
+  using Clock = std::chrono::steady_clock;
+
+  iterations = 0;
+  mean_squared_error = 0.0;
+  iteration_times.clear();
+
+  source_matches.clear();
+  target_matches.clear();
+
+  if (source.empty() || target_points.empty()) {
+    return false;
+  }
+
+  auto start = Clock::now();
+  double last_time = 0.0;
+
+  while (iterations < max_iterations) {
+    auto iteration_start = Clock::now();
+
+    double elapsed = std::chrono::duration<double>(iteration_start - start).count();
+    if (time_limit > 0.0 && iterations > 0 && elapsed + last_time > time_limit) {
+      break;
+    }
+
+    pose.transform(source, transformed);
+    find_correspondences();
+
+    Pose2 step;
+    bool is_solved = method == IcpMethod::PointToPoint ?
+      point_to_point_step(step) : point_to_line_step(step);
+
+    ++iterations;
+    last_time = std::chrono::duration<double>(Clock::now() - iteration_start).count();
+    iteration_times.push_back(last_time);
+
+    if (!is_solved) {
+      return false;
+    }
+
+    pose = step * pose;
+
+    const Point2 & translation = step.get_position();
+    if (translation.dot(translation) <= translation_tolerance * translation_tolerance &&
+      std::abs(step.get_orientation().radian()) <= rotation_tolerance)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+inline size_t Icp2::get_iterations() const
+{
+  return iterations;
+}
+
+inline size_t Icp2::get_correspondence_count() const
+{
+  return source_matches.size();
+}
+
+inline double Icp2::get_mean_squared_error() const
+{
+  return mean_squared_error;
+}
+
+inline const std::vector<double> & Icp2::get_iteration_times() const
+{
+  return iteration_times;
+}
+
+inline void Icp2::find_correspondences()
+{
+  source_matches.clear();
+  target_matches.clear();
+
+  double sum = 0.0;
+  for (size_t i = 0; i < transformed.size(); ++i) {
+    double squared_distance;
+    size_t index = tree.nearest(transformed[i], &squared_distance);
+
+    if (squared_distance <= squared_max_distance) {
+      source_matches.push_back(i);
+      target_matches.push_back(index);
+      sum += squared_distance;
+    }
+  }
+
+  mean_squared_error = source_matches.empty() ? 0.0 : sum / source_matches.size();
+}
+
+inline bool Icp2::point_to_point_step(Pose2 & step) const
+{
+  size_t count = source_matches.size();
+  if (count < 2) {
+    return false;
+  }
+
+  Point2 source_mean(0.0, 0.0);
+  Point2 target_mean(0.0, 0.0);
+  for (size_t i = 0; i < count; ++i) {
+    source_mean += transformed[source_matches[i]];
+    target_mean += target_points[target_matches[i]];
+  }
+
+  source_mean /= count;
+  target_mean /= count;
+
+  // Closed form rotation of the 2D Procrustes problem, no SVD needed.
+  double dot = 0.0;
+  double cross = 0.0;
+  for (size_t i = 0; i < count; ++i) {
+    Point2 p = transformed[source_matches[i]] - source_mean;
+    Point2 q = target_points[target_matches[i]] - target_mean;
+
+    dot += p.dot(q);
+    cross += p.cross(q);
+  }
+
+  auto rotation = make_radian(std::atan2(cross, dot));
+  step = Pose2(target_mean - source_mean.rotate(rotation), rotation);
+
+  return true;
+}
+
+inline bool Icp2::point_to_line_step(Pose2 & step) const
+{
+  size_t count = source_matches.size();
+  if (count < 3) {
+    return false;
+  }
+
+  // Small angle linearization of the distances along the target normals, solved for the
+  // rotation and the translation.
+  Matrix<3, 3> normal = Matrix<3, 3>::zero();
+  Vector<3> right = Vector<3>::zero();
+  for (size_t i = 0; i < count; ++i) {
+    const Point2 & p = transformed[source_matches[i]];
+    const Point2 & q = target_points[target_matches[i]];
+    const Point2 & n = target_normals[target_matches[i]];
+
+    double terms[3] = {p.cross(n), n.x, n.y};
+    double residual = (q - p).dot(n);
+
+    for (size_t j = 0; j < 3; ++j) {
+      for (size_t k = 0; k < 3; ++k) {
+        normal[j][k] += terms[j] * terms[k];
+      }
+
+      right[j] += terms[j] * residual;
+    }
+  }
+
+  Vector<3> solution;
+  if (!detail::solve_3x3(normal, right, solution)) {
+    return false;
+  }
+
+  step = Pose2(Point2(solution[1], solution[2]), make_radian(solution[0]));
+
+  return true;
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__ICP_2_IMPL_HPP_
@@ -0,0 +1,110 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__KD_TREE_HPP_
+#define KEISAN__GEOMETRY__KD_TREE_HPP_
+
+#include <vector>
+
+#include "keisan/geometry/point_2.hpp"
+#include "keisan/geometry/point_3.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+template<typename Point>
+struct KdTreeTraits;
+
+template<>
+struct KdTreeTraits<Point2>
+{
+  static constexpr size_t dimension = 2;
+
+  static double coordinate(const Point2 & point, size_t axis)
+  {
+    return axis == 0 ? point.x : point.y;
+  }
+};
+
+template<>
+struct KdTreeTraits<Point3>
+{
+  static constexpr size_t dimension = 3;
+
+  static double coordinate(const Point3 & point, size_t axis)
+  {
+    return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+  }
+};
+
+}  // namespace detail
+
+// Balanced tree stored implicitly in one array, each range is split on its median element and the
+// children are the ranges on both sides of it, so no child links are needed.
+// Indices reported by the queries refer to the points the tree was built from.
+template<typename Point>
+class KdTree
+{
+public:
+  KdTree() = default;
+  explicit KdTree(const std::vector<Point> & points);
+
+  // Rebuilding with no more points than before reuses the previous storage.
+  void build(const std::vector<Point> & points);
+
+  size_t size() const;
+  bool empty() const;
+
+  // Index of the closest point, or size() for an empty tree.
+  size_t nearest(const Point & point, double * squared_distance = nullptr) const;
+
+  // The closest count points, sorted from the closest.
+  void nearest(
+    const Point & point, size_t count,
+    std::vector<size_t> & indices, std::vector<double> & squared_distances) const;
+
+  // Every point within the radius, in no particular order.
+  void within(
+    const Point & point, double radius,
+    std::vector<size_t> & indices, std::vector<double> & squared_distances) const;
+
+private:
+  using Traits = detail::KdTreeTraits<Point>;
+
+  static constexpr size_t leaf_size = 8;
+
+  void split(const std::vector<Point> & points, size_t begin, size_t end);
+
+  template<typename Visitor>
+  void search(const Point & point, Visitor & visitor) const;
+
+  std::vector<Point> tree_points;
+  std::vector<size_t> tree_indices;
+  std::vector<unsigned char> split_axes;
+};
+
+}  // namespace keisan
+
+#include "keisan/geometry/kd_tree.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__KD_TREE_HPP_
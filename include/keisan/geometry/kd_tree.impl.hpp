@@ -0,0 +1,300 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__KD_TREE_IMPL_HPP_
+#define KEISAN__GEOMETRY__KD_TREE_IMPL_HPP_
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "keisan/geometry/kd_tree.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+template<typename Point>
+double kd_tree_squared_distance(const Point & a, const Point & b)
+{
+  Point difference = a - b;
+  return difference.dot(difference);
+}
+
+struct KdTreeNearest
+{
+  double bound() const
+  {
+    return squared_distance;
+  }
+
+  void visit(size_t position, double distance)
+  {
+    if (distance < squared_distance) {
+      squared_distance = distance;
+      this->position = position;
+    }
+  }
+
+  size_t position;
+  double squared_distance;
+};
+
+struct KdTreeKNearest
+{
+  double bound() const
+  {
+    return squared_distances.size() < count ?
+      std::numeric_limits<double>::infinity() : squared_distances.back();
+  }
+
+  // Insertion into the sorted results, count is expected to be small.
+  void visit(size_t position, double distance)
+  {
+    size_t i = squared_distances.size();
+    if (i < count) {
+      positions.push_back(position);
+      squared_distances.push_back(distance);
+    } else if (distance < squared_distances.back()) {
+      --i;
+    } else {
+      return;
+    }
+
+    for (; i > 0 && squared_distances[i - 1] > distance; --i) {
+      positions[i] = positions[i - 1];
+      squared_distances[i] = squared_distances[i - 1];
+    }
+
+    positions[i] = position;
+    squared_distances[i] = distance;
+  }
+
+  std::vector<size_t> & positions;
+  std::vector<double> & squared_distances;
+  size_t count;
+};
+
+struct KdTreeWithin
+{
+  double bound() const
+  {
+    return squared_radius;
+  }
+
+  void visit(size_t position, double distance)
+  {
+    if (distance <= squared_radius) {
+      positions.push_back(position);
+      squared_distances.push_back(distance);
+    }
+  }
+
+  std::vector<size_t> & positions;
+  std::vector<double> & squared_distances;
+  double squared_radius;
+};
+
+}  // namespace detail
+
+template<typename Point>
+KdTree<Point>::KdTree(const std::vector<Point> & points)
+{
+  build(points);
+}
+
+template<typename Point>
+void KdTree<Point>::build(const std::vector<Point> & points)
+{
+  tree_indices.resize(points.size());
+  std::iota(tree_indices.begin(), tree_indices.end(), 0);
+
+  split_axes.resize(points.size());
+  split(points, 0, points.size());
+
+  tree_points.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    tree_points[i] = points[tree_indices[i]];
+  }
+}
+
+template<typename Point>
+size_t KdTree<Point>::size() const
+{
+  return tree_points.size();
+}
+
+template<typename Point>
+bool KdTree<Point>::empty() const
+{
+  return tree_points.empty();
+}
+
+template<typename Point>
+size_t KdTree<Point>::nearest(const Point & point, double * squared_distance) const
+{
+  detail::KdTreeNearest visitor{size(), std::numeric_limits<double>::infinity()};
+  search(point, visitor);
+
+  if (squared_distance) {
+    *squared_distance = visitor.squared_distance;
+  }
+
+  return visitor.position < size() ? tree_indices[visitor.position] : size();
+}
+
+template<typename Point>
+void KdTree<Point>::nearest(
+  const Point & point, size_t count,
+  std::vector<size_t> & indices, std::vector<double> & squared_distances) const
+{
+  indices.clear();
+  squared_distances.clear();
+
+  if (count == 0) {
+    return;
+  }
+
+  detail::KdTreeKNearest visitor{indices, squared_distances, count};
+  search(point, visitor);
+
+  for (auto & index : indices) {
+    index = tree_indices[index];
+  }
+}
+
+template<typename Point>
+void KdTree<Point>::within(
+  const Point & point, double radius,
+  std::vector<size_t> & indices, std::vector<double> & squared_distances) const
+{
+  indices.clear();
+  squared_distances.clear();
+
+  detail::KdTreeWithin visitor{indices, squared_distances, radius * radius};
+  search(point, visitor);
+
+  for (auto & index : indices) {
+    index = tree_indices[index];
+  }
+}
+
+template<typename Point>
+void KdTree<Point>::split(const std::vector<Point> & points, size_t begin, size_t end)
+{
+  if (end - begin <= leaf_size) {
+    return;
+  }
+
+  // Split on the axis with the widest spread.
+  size_t axis = 0;
+  double widest = -1.0;
+  for (size_t i = 0; i < Traits::dimension; ++i) {
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    for (size_t j = begin; j < end; ++j) {
+      double value = Traits::coordinate(points[tree_indices[j]], i);
+      min = std::min(min, value);
+      max = std::max(max, value);
+    }
+
+    if (max - min > widest) {
+      widest = max - min;
+      axis = i;
+    }
+  }
+
+  size_t mid = begin + (end - begin) / 2;
+  std::nth_element(
+    tree_indices.begin() + begin, tree_indices.begin() + mid, tree_indices.begin() + end,
+    [&](size_t a, size_t b) {
+      return Traits::coordinate(points[a], axis) < Traits::coordinate(points[b], axis);
+    });
+
+  split_axes[mid] = axis;
+
+  split(points, begin, mid);
+  split(points, mid + 1, end);
+}
+
+template<typename Point>
+template<typename Visitor>
+void KdTree<Point>::search(const Point & point, Visitor & visitor) const
+{
+  if (empty()) {
+    return;
+  }
+
+  struct Range
+  {
+    size_t begin;
+    size_t end;
+    double bound;
+  };
+
+  // Every split replaces a range with its two halves, so the stack grows by one per tree level.
+  Range stack[2 * std::numeric_limits<size_t>::digits];
+  size_t top = 0;
+
+  stack[top++] = Range{0, size(), 0.0};
+  while (top > 0) {
+    Range range = stack[--top];
+    if (range.bound > visitor.bound()) {
+      continue;
+    }
+
+    if (range.end - range.begin <= leaf_size) {
+      for (size_t i = range.begin; i < range.end; ++i) {
+        visitor.visit(i, detail::kd_tree_squared_distance(point, tree_points[i]));
+      }
+
+      continue;
+    }
+
+    size_t mid = range.begin + (range.end - range.begin) / 2;
+    size_t axis = split_axes[mid];
+
+    visitor.visit(mid, detail::kd_tree_squared_distance(point, tree_points[mid]));
+
+    double difference =
+      Traits::coordinate(point, axis) - Traits::coordinate(tree_points[mid], axis);
+
+    Range lower{range.begin, mid, range.bound};
+    Range upper{mid + 1, range.end, range.bound};
+
+    // The far side is pushed first, so the near side is searched first.
+    if (difference < 0.0) {
+      upper.bound = std::max(range.bound, difference * difference);
+      stack[top++] = upper;
+      stack[top++] = lower;
+    } else {
+      lower.bound = std::max(range.bound, difference * difference);
+      stack[top++] = lower;
+      stack[top++] = upper;
+    }
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__KD_TREE_IMPL_HPP_
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef KEISAN__GEOMETRY__PINHOLE_CAMERA_HPP_
+#define KEISAN__GEOMETRY__PINHOLE_CAMERA_HPP_
+
+#include "keisan/geometry/aligned_vector.hpp"
+#include "keisan/geometry/dual_quaternion.hpp"
+#include "keisan/geometry/point_2.hpp"
+#include "keisan/geometry/point_3.hpp"
+#include "keisan/geometry/point_cloud_2.hpp"
+#include "keisan/geometry/point_cloud_3.hpp"
+
+namespace keisan
+{
+
+// Pinhole camera with Brown-Conrady distortion. The camera looks along its z axis with x to the
+// right and y down in the image, and its pose maps camera coordinates into the world frame.
+class PinholeCamera
+{
+public:
+  PinholeCamera(double fx, double fy, double cx, double cy);
+
+  // Coefficients in the same order as OpenCV, k1, k2, p1, p2 and k3.
+  void set_distortion(double k1, double k2, double p1, double p2, double k3 = 0.0);
+
+  void set_pose(const DualQuaternion<double> & pose);
+  const DualQuaternion<double> & get_pose() const;
+
+  // Works on normalized image coordinates, undistort inverts distort iteratively.
+  Point2 distort(const Point2 & point) const;
+  Point2 undistort(const Point2 & point) const;
+
+  // Precompute the undistorted coordinates of every pixel of a fixed resolution, pixels inside
+  // the table are then interpolated instead of iterated.
+  void build_undistortion_table(size_t width, size_t height);
+  void clear_undistortion_table();
+
+  // False when the point is not in front of the camera.
+  bool project(const Point3 & point, Point2 & pixel) const;
+
+  // False when the pixel ray does not hit the plane z = height in front of the camera.
+  bool unproject_to_plane(const Point2 & pixel, Point2 & point, double height = 0.0) const;
+
+  // Failed points are stored as NaN.
+  void project(const PointCloud3 & points, PointCloud2 & pixels) const;
+  void unproject_to_plane(
+    const PointCloud2 & pixels, PointCloud2 & points, double height = 0.0) const;
+
+private:
+  Point2 normalized_ray(double u, double v) const;
+
+  double fx;
+  double fy;
+  double cx;
+  double cy;
+
+  double k1;
+  double k2;
+  double k3;
+  double p1;
+  double p2;
+
+  DualQuaternion<double> pose;
+  double rotation[3][3];
+  Point3 position;
+
+  size_t table_width;
+  size_t table_height;
+  AlignedVector<double> table_x;
+  AlignedVector<double> table_y;
+};
+
+}  // namespace keisan
+
+#include "keisan/geometry/pinhole_camera.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__PINHOLE_CAMERA_HPP_
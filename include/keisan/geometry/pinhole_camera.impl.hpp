@@ -0,0 +1,273 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef KEISAN__GEOMETRY__PINHOLE_CAMERA_IMPL_HPP_
+#define KEISAN__GEOMETRY__PINHOLE_CAMERA_IMPL_HPP_
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "keisan/geometry/pinhole_camera.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+constexpr int undistortion_iterations = 20;
+
+}  // namespace detail
+
+inline PinholeCamera::PinholeCamera(double fx, double fy, double cx, double cy)
+: fx(fx), fy(fy), cx(cx), cy(cy), k1(0.0), k2(0.0), k3(0.0), p1(0.0), p2(0.0),
+  table_width(0), table_height(0)
+{
+  if (!(fx > 0.0 && fy > 0.0)) {
+    throw std::invalid_argument("focal length must be positive");
+  }
+
+  set_pose(DualQuaternion<double>::identity());
+}
+
+inline void PinholeCamera::set_distortion(double k1, double k2, double p1, double p2, double k3)
+{
+  this->k1 = k1;
+  this->k2 = k2;
+  this->k3 = k3;
+  this->p1 = p1;
+  this->p2 = p2;
+
+  if (table_width > 0) {
+    build_undistortion_table(table_width, table_height);
+  }
+}
+
+inline void PinholeCamera::set_pose(const DualQuaternion<double> & pose)
+{
+  this->pose = pose;
+
+  auto matrix = rotation_matrix(pose.rotation());
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      rotation[i][j] = matrix[i][j];
+    }
+  }
+
+  position = pose.translation();
+}
+
+inline const DualQuaternion<double> & PinholeCamera::get_pose() const
+{
+  return pose;
+}
+
+inline Point2 PinholeCamera::distort(const Point2 & point) const
+{
+  double x = point.x;
+  double y = point.y;
+
+  double r2 = x * x + y * y;
+  double radial = 1.0 + r2 * (k1 + r2 * (k2 + r2 * k3));
+
+  return Point2(
+    x * radial + 2.0 * p1 * x * y + p2 * (r2 + 2.0 * x * x),
+    y * radial + p1 * (r2 + 2.0 * y * y) + 2.0 * p2 * x * y);
+}
+
+inline Point2 PinholeCamera::undistort(const Point2 & point) const
+{
+  double x = point.x;
+  double y = point.y;
+
+  // Fixed point iteration, converges for the moderate distortion of typical lenses.
+  for (int i = 0; i < detail::undistortion_iterations; ++i) {
+    double r2 = x * x + y * y;
+    double radial = 1.0 + r2 * (k1 + r2 * (k2 + r2 * k3));
+
+    double dx = 2.0 * p1 * x * y + p2 * (r2 + 2.0 * x * x);
+    double dy = p1 * (r2 + 2.0 * y * y) + 2.0 * p2 * x * y;
+
+    x = (point.x - dx) / radial;
+    y = (point.y - dy) / radial;
+  }
+
+  return Point2(x, y);
+}
+
+inline void PinholeCamera::build_undistortion_table(size_t width, size_t height)
+{
+  if (width < 2 || height < 2) {
+    throw std::invalid_argument("table size must be at least 2x2");
+  }
+
+  table_width = width;
+  table_height = height;
+  table_x.resize(width * height);
+  table_y.resize(width * height);
+
+  for (size_t v = 0; v < height; ++v) {
+    for (size_t u = 0; u < width; ++u) {
+      auto point = undistort(Point2((u - cx) / fx, (v - cy) / fy));
+      table_x[v * width + u] = point.x;
+      table_y[v * width + u] = point.y;
+    }
+  }
+}
+
+inline void PinholeCamera::clear_undistortion_table()
+{
+  table_width = 0;
+  table_height = 0;
+  table_x.clear();
+  table_y.clear();
+}
+
+inline bool PinholeCamera::project(const Point3 & point, Point2 & pixel) const
+{
+  double px = point.x - position.x;
+  double py = point.y - position.y;
+  double pz = point.z - position.z;
+
+  // The transposed rotation maps world offsets back into the camera frame.
+  double x = rotation[0][0] * px + rotation[1][0] * py + rotation[2][0] * pz;
+  double y = rotation[0][1] * px + rotation[1][1] * py + rotation[2][1] * pz;
+  double z = rotation[0][2] * px + rotation[1][2] * py + rotation[2][2] * pz;
+
+  if (!(z > 0.0)) {
+    return false;
+  }
+
+  auto distorted = distort(Point2(x / z, y / z));
+  pixel = Point2(fx * distorted.x + cx, fy * distorted.y + cy);
+
+  return true;
+}
+
+inline bool PinholeCamera::unproject_to_plane(
+  const Point2 & pixel, Point2 & point, double height) const
+{
+  auto ray = normalized_ray(pixel.x, pixel.y);
+
+  double dx = rotation[0][0] * ray.x + rotation[0][1] * ray.y + rotation[0][2];
+  double dy = rotation[1][0] * ray.x + rotation[1][1] * ray.y + rotation[1][2];
+  double dz = rotation[2][0] * ray.x + rotation[2][1] * ray.y + rotation[2][2];
+
+  double t = (height - position.z) / dz;
+  if (!(t > 0.0 && std::isfinite(t))) {
+    return false;
+  }
+
+  point = Point2(position.x + t * dx, position.y + t * dy);
+
+  return true;
+}
+
+inline void PinholeCamera::project(const PointCloud3 & points, PointCloud2 & pixels) const
+{
+  pixels.resize(points.size());
+
+  const double * xs = points.xs().data();
+  const double * ys = points.ys().data();
+  const double * zs = points.zs().data();
+  double * us = pixels.x_data();
+  double * vs = pixels.y_data();
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    double px = xs[i] - position.x;
+    double py = ys[i] - position.y;
+    double pz = zs[i] - position.z;
+
+    double x = rotation[0][0] * px + rotation[1][0] * py + rotation[2][0] * pz;
+    double y = rotation[0][1] * px + rotation[1][1] * py + rotation[2][1] * pz;
+    double z = rotation[0][2] * px + rotation[1][2] * py + rotation[2][2] * pz;
+
+    // Selecting before the division keeps the loop free of branches, NaN carries through.
+    double valid = z > 0.0 ? 1.0 : nan;
+    double inverse = 1.0 / z;
+    x *= inverse;
+    y *= inverse;
+
+    double r2 = x * x + y * y;
+    double radial = 1.0 + r2 * (k1 + r2 * (k2 + r2 * k3));
+    double u = fx * (x * radial + 2.0 * p1 * x * y + p2 * (r2 + 2.0 * x * x)) + cx;
+    double v = fy * (y * radial + p1 * (r2 + 2.0 * y * y) + 2.0 * p2 * x * y) + cy;
+
+    us[i] = u * valid;
+    vs[i] = v * valid;
+  }
+}
+
+inline void PinholeCamera::unproject_to_plane(
+  const PointCloud2 & pixels, PointCloud2 & points, double height) const
+{
+  points.resize(pixels.size());
+
+  const double * us = pixels.xs().data();
+  const double * vs = pixels.ys().data();
+  double * xs = points.x_data();
+  double * ys = points.y_data();
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double offset = height - position.z;
+
+  for (size_t i = 0; i < pixels.size(); ++i) {
+    auto ray = normalized_ray(us[i], vs[i]);
+
+    double dx = rotation[0][0] * ray.x + rotation[0][1] * ray.y + rotation[0][2];
+    double dy = rotation[1][0] * ray.x + rotation[1][1] * ray.y + rotation[1][2];
+    double dz = rotation[2][0] * ray.x + rotation[2][1] * ray.y + rotation[2][2];
+
+    double t = offset / dz;
+    bool hit = t > 0.0 && t < std::numeric_limits<double>::infinity();
+
+    xs[i] = hit ? position.x + t * dx : nan;
+    ys[i] = hit ? position.y + t * dy : nan;
+  }
+}
+
+inline Point2 PinholeCamera::normalized_ray(double u, double v) const
+{
+  // Pixels outside the table, or with a table absent, fall back to the iterative undistortion.
+  if (u >= 0.0 && v >= 0.0 && u < table_width - 1.0 && v < table_height - 1.0) {
+    size_t column = static_cast<size_t>(u);
+    size_t row = static_cast<size_t>(v);
+    double a = u - column;
+    double b = v - row;
+
+    size_t index = row * table_width + column;
+    size_t below = index + table_width;
+
+    return Point2(
+      (1.0 - b) * ((1.0 - a) * table_x[index] + a * table_x[index + 1]) +
+      b * ((1.0 - a) * table_x[below] + a * table_x[below + 1]),
+      (1.0 - b) * ((1.0 - a) * table_y[index] + a * table_y[index + 1]) +
+      b * ((1.0 - a) * table_y[below] + a * table_y[below + 1]));
+  }
+
+  return undistort(Point2((u - cx) / fx, (v - cy) / fy));
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__PINHOLE_CAMERA_IMPL_HPP_
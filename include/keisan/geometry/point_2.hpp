@@ -31,57 +31,57 @@ namespace keisan
 
 struct Point2
 {
-  Point2();
-  Point2(double x, double y);
+  Point2() = default;
+  constexpr Point2(double x, double y);
   explicit Point2(const Vector<2> & vector);
   explicit Point2(const Vector<3> & vector);
-  Point2(const Point2 & point);
+  Point2(const Point2 & point) = default;
 
   operator Vector<2>() const;
   operator Vector<3>() const;
 
-  static Point2 zero();
+  static constexpr Point2 zero();
 
-  Point2 & operator=(const Point2 & point);
+  Point2 & operator=(const Point2 & point) = default;
 
-  bool operator==(const Point2 & other) const;
-  bool operator!=(const Point2 & other) const;
+  constexpr bool operator==(const Point2 & other) const;
+  constexpr bool operator!=(const Point2 & other) const;
 
-  Point2 & operator+=(const Point2 & other);
-  Point2 & operator-=(const Point2 & other);
+  constexpr Point2 & operator+=(const Point2 & other);
+  constexpr Point2 & operator-=(const Point2 & other);
 
-  Point2 & operator+=(const double & value);
-  Point2 & operator-=(const double & value);
-  Point2 & operator*=(const double & value);
-  Point2 & operator/=(const double & value);
+  constexpr Point2 & operator+=(const double & value);
+  constexpr Point2 & operator-=(const double & value);
+  constexpr Point2 & operator*=(const double & value);
+  constexpr Point2 & operator/=(const double & value);
 
-  Point2 operator+(const Point2 & other) const;
-  Point2 operator-(const Point2 & other) const;
+  constexpr Point2 operator+(const Point2 & other) const;
+  constexpr Point2 operator-(const Point2 & other) const;
 
-  Point2 operator+(const double & value) const;
-  Point2 operator-(const double & value) const;
-  Point2 operator*(const double & value) const;
-  Point2 operator/(const double & value) const;
+  constexpr Point2 operator+(const double & value) const;
+  constexpr Point2 operator-(const double & value) const;
+  constexpr Point2 operator*(const double & value) const;
+  constexpr Point2 operator/(const double & value) const;
 
-  Point2 operator-() const;
+  constexpr Point2 operator-() const;
 
   double magnitude() const;
   Angle<double> direction() const;
 
   Point2 normalize() const;
 
-  double dot(const Point2 & other) const;
-  double cross(const Point2 & other) const;
+  constexpr double dot(const Point2 & other) const;
+  constexpr double cross(const Point2 & other) const;
 
-  Point2 translate(const Point2 & translation) const;
+  constexpr Point2 translate(const Point2 & translation) const;
 
-  Point2 scale(const Point2 & scaling) const;
-  Point2 scale(const double & scaling) const;
+  constexpr Point2 scale(const Point2 & scaling) const;
+  constexpr Point2 scale(const double & scaling) const;
 
   Point2 rotate(const Angle<double> & rotation) const;
 
-  Point2 scale_from(const Point2 & scaling, const Point2 & anchor) const;
-  Point2 scale_from(const double & scaling, const Point2 & anchor) const;
+  constexpr Point2 scale_from(const Point2 & scaling, const Point2 & anchor) const;
+  constexpr Point2 scale_from(const double & scaling, const Point2 & anchor) const;
 
   Point2 rotate_from(const Angle<double> & rotation, const Point2 & anchor) const;
 
@@ -91,6 +91,8 @@ struct Point2
 
 }  // namespace keisan
 
-keisan::Point2 operator*(const double & value, const keisan::Point2 & point);
+constexpr keisan::Point2 operator*(const double & value, const keisan::Point2 & point);
+
+#include "keisan/geometry/point_2.impl.hpp"
 
 #endif  // KEISAN__GEOMETRY__POINT_2_HPP_
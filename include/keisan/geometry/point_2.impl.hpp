@@ -1,4 +1,4 @@
-// Copyright (c) 2021 ICHIRO ITS
+// Copyright (c) 2026 ICHIRO ITS
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -18,12 +18,15 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#ifndef KEISAN__GEOMETRY__POINT_2_IMPL_HPP_
+#define KEISAN__GEOMETRY__POINT_2_IMPL_HPP_
+
 #include <cmath>
 
 #include "keisan/angle.hpp"
 #include "keisan/geometry/point_2.hpp"
 
-keisan::Point2 operator*(const double & value, const keisan::Point2 & point)
+constexpr keisan::Point2 operator*(const double & value, const keisan::Point2 & point)
 {
   return point * value;
 }
@@ -31,67 +34,50 @@ keisan::Point2 operator*(const double & value, const keisan::Point2 & point)
 namespace keisan
 {
 
-Point2::Point2()
-{
-}
-
-Point2::Point2(double x, double y)
+constexpr Point2::Point2(double x, double y)
 : x(x),
   y(y)
 {
 }
 
-Point2::Point2(const Vector<2> & vector)
+inline Point2::Point2(const Vector<2> & vector)
 : x(vector[0]),
   y(vector[1])
 {
 }
 
-Point2::Point2(const Vector<3> & vector)
+inline Point2::Point2(const Vector<3> & vector)
 : x(vector[0] / vector[2]),
   y(vector[1] / vector[2])
 {
 }
 
-Point2::Point2(const Point2 & point)
-{
-  *this = point;
-}
-
-Point2::operator Vector<2>() const
+inline Point2::operator Vector<2>() const
 {
   return Vector<2>(x, y);
 }
 
-Point2::operator Vector<3>() const
+inline Point2::operator Vector<3>() const
 {
   return Vector<3>(x, y, 1.0);
 }
 
-Point2 Point2::zero()
+constexpr Point2 Point2::zero()
 {
   return Point2(0.0, 0.0);
 }
 
-Point2 & Point2::operator=(const Point2 & point)
-{
-  x = point.x;
-  y = point.y;
-
-  return *this;
-}
-
-bool Point2::operator==(const Point2 & other) const
+constexpr bool Point2::operator==(const Point2 & other) const
 {
   return x == other.x && y == other.y;
 }
 
-bool Point2::operator!=(const Point2 & other) const
+constexpr bool Point2::operator!=(const Point2 & other) const
 {
   return x != other.x || y != other.y;
 }
 
-Point2 & Point2::operator+=(const Point2 & other)
+constexpr Point2 & Point2::operator+=(const Point2 & other)
 {
   x += other.x;
   y += other.y;
@@ -99,7 +85,7 @@ Point2 & Point2::operator+=(const Point2 & other)
   return *this;
 }
 
-Point2 & Point2::operator-=(const Point2 & other)
+constexpr Point2 & Point2::operator-=(const Point2 & other)
 {
   x -= other.x;
   y -= other.y;
@@ -107,7 +93,7 @@ Point2 & Point2::operator-=(const Point2 & other)
   return *this;
 }
 
-Point2 & Point2::operator+=(const double & value)
+constexpr Point2 & Point2::operator+=(const double & value)
 {
   x += value;
   y += value;
@@ -115,7 +101,7 @@ Point2 & Point2::operator+=(const double & value)
   return *this;
 }
 
-Point2 & Point2::operator-=(const double & value)
+constexpr Point2 & Point2::operator-=(const double & value)
 {
   x -= value;
   y -= value;
@@ -123,7 +109,7 @@ Point2 & Point2::operator-=(const double & value)
   return *this;
 }
 
-Point2 & Point2::operator*=(const double & value)
+constexpr Point2 & Point2::operator*=(const double & value)
 {
   x *= value;
   y *= value;
@@ -131,7 +117,7 @@ Point2 & Point2::operator*=(const double & value)
   return *this;
 }
 
-Point2 & Point2::operator/=(const double & value)
+constexpr Point2 & Point2::operator/=(const double & value)
 {
   x /= value;
   y /= value;
@@ -139,105 +125,104 @@ Point2 & Point2::operator/=(const double & value)
   return *this;
 }
 
-Point2 Point2::operator+(const Point2 & other) const
+constexpr Point2 Point2::operator+(const Point2 & other) const
 {
   return Point2(x + other.x, y + other.y);
 }
 
-Point2 Point2::operator-(const Point2 & other) const
+constexpr Point2 Point2::operator-(const Point2 & other) const
 {
   return Point2(x - other.x, y - other.y);
 }
 
-Point2 Point2::operator+(const double & value) const
+constexpr Point2 Point2::operator+(const double & value) const
 {
   return Point2(x + value, y + value);
 }
 
-Point2 Point2::operator-(const double & value) const
+constexpr Point2 Point2::operator-(const double & value) const
 {
   return Point2(x - value, y - value);
 }
 
-Point2 Point2::operator*(const double & value) const
+constexpr Point2 Point2::operator*(const double & value) const
 {
   return Point2(x * value, y * value);
 }
 
-Point2 Point2::operator/(const double & value) const
+constexpr Point2 Point2::operator/(const double & value) const
 {
   return Point2(x / value, y / value);
 }
 
-Point2 Point2::operator-() const
+constexpr Point2 Point2::operator-() const
 {
   return Point2(-x, -y);
 }
 
-double Point2::magnitude() const
+inline double Point2::magnitude() const
 {
   return std::hypot(x, y);
 }
 
-Angle<double> Point2::direction() const
+inline Angle<double> Point2::direction() const
 {
   return signed_arctan(y, x);
 }
 
-Point2 Point2::normalize() const
+inline Point2 Point2::normalize() const
 {
   double mag = magnitude();
   return Point2(x / mag, y / mag);
 }
 
-double Point2::dot(const Point2 & other) const
+constexpr double Point2::dot(const Point2 & other) const
 {
   return x * other.x + y * other.y;
 }
 
-double Point2::cross(const Point2 & other) const
+constexpr double Point2::cross(const Point2 & other) const
 {
   return x * other.y - y * other.x;
 }
 
-Point2 Point2::translate(const Point2 & translation) const
+constexpr Point2 Point2::translate(const Point2 & translation) const
 {
   return *this + translation;
 }
 
-Point2 Point2::scale(const Point2 & scaling) const
+constexpr Point2 Point2::scale(const Point2 & scaling) const
 {
   return Point2(x * scaling.x, y * scaling.y);
 }
 
-Point2 Point2::scale(const double & scaling) const
+constexpr Point2 Point2::scale(const double & scaling) const
 {
   return scale({scaling, scaling});
 }
 
-Point2 Point2::rotate(const Angle<double> & rotation) const
+inline Point2 Point2::rotate(const Angle<double> & rotation) const
 {
-  Point2 point;
-
-  point.x = x * rotation.cos() - y * rotation.sin();
-  point.y = x * rotation.sin() + y * rotation.cos();
+  auto [sin, cos] = rotation.sincos();
 
-  return point;
+  return Point2(x * cos - y * sin, x * sin + y * cos);
 }
 
-Point2 Point2::scale_from(const Point2 & scaling, const Point2 & anchor) const
+constexpr Point2 Point2::scale_from(const Point2 & scaling, const Point2 & anchor) const
 {
   return translate(-anchor).scale(scaling).translate(anchor);
 }
 
-Point2 Point2::scale_from(const double & scaling, const Point2 & anchor) const
+constexpr Point2 Point2::scale_from(const double & scaling, const Point2 & anchor) const
 {
   return translate(-anchor).scale(scaling).translate(anchor);
 }
 
-Point2 Point2::rotate_from(const Angle<double> & rotation, const Point2 & anchor) const
+inline Point2 Point2::rotate_from(const Angle<double> & rotation, const Point2 & anchor) const
 {
   return translate(-anchor).rotate(rotation).translate(anchor);
 }
 
 }  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__POINT_2_IMPL_HPP_
@@ -31,46 +31,49 @@ namespace keisan
 
 struct Point3
 {
-  Point3();
-  Point3(double x, double y, double z);
+  Point3() = default;
+  constexpr Point3(double x, double y, double z);
   explicit Point3(const Vector<3> & vector);
   explicit Point3(const Vector<4> & vector);
-  Point3(const Point3 & point);
+  Point3(const Point3 & point) = default;
 
   operator Vector<3>() const;
   operator Vector<4>() const;
 
-  static Point3 zero();
+  static constexpr Point3 zero();
 
-  Point3 & operator=(const Point3 & point);
+  Point3 & operator=(const Point3 & point) = default;
 
-  bool operator==(const Point3 & other) const;
-  bool operator!=(const Point3 & other) const;
+  constexpr bool operator==(const Point3 & other) const;
+  constexpr bool operator!=(const Point3 & other) const;
 
-  Point3 & operator+=(const Point3 & other);
-  Point3 & operator-=(const Point3 & other);
+  constexpr Point3 & operator+=(const Point3 & other);
+  constexpr Point3 & operator-=(const Point3 & other);
 
-  Point3 & operator+=(const double & value);
-  Point3 & operator-=(const double & value);
-  Point3 & operator*=(const double & value);
-  Point3 & operator/=(const double & value);
+  constexpr Point3 & operator+=(const double & value);
+  constexpr Point3 & operator-=(const double & value);
+  constexpr Point3 & operator*=(const double & value);
+  constexpr Point3 & operator/=(const double & value);
 
-  Point3 operator+(const Point3 & other) const;
-  Point3 operator-(const Point3 & other) const;
+  constexpr Point3 operator+(const Point3 & other) const;
+  constexpr Point3 operator-(const Point3 & other) const;
 
-  Point3 operator+(const double & value) const;
-  Point3 operator-(const double & value) const;
-  Point3 operator*(const double & value) const;
-  Point3 operator/(const double & value) const;
+  constexpr Point3 operator+(const double & value) const;
+  constexpr Point3 operator-(const double & value) const;
+  constexpr Point3 operator*(const double & value) const;
+  constexpr Point3 operator/(const double & value) const;
 
-  Point3 operator-() const;
+  constexpr Point3 operator-() const;
 
   double magnitude() const;
 
   Point3 normalize() const;
 
-  double dot(const Point3 & other) const;
-  Point3 cross(const Point3 & other) const;
+  constexpr double dot(const Point3 & other) const;
+  constexpr Point3 cross(const Point3 & other) const;
+
+  // Expects a unit quaternion, the inverse is assumed to be its conjugate.
+  Point3 rotate(const Quaternion<double> & rotation) const;
 
   double x;
   double y;
@@ -81,6 +84,8 @@ struct Point3
 
 std::ostream & operator<<(std::ostream & out, const keisan::Point3 point);
 
-keisan::Point3 operator*(const double & value, const keisan::Point3 & point);
+constexpr keisan::Point3 operator*(const double & value, const keisan::Point3 & point);
+
+#include "keisan/geometry/point_3.impl.hpp"
 
 #endif  // KEISAN__GEOMETRY__POINT_3_HPP_
@@ -1,4 +1,4 @@
-// Copyright (c) 2021 ICHIRO ITS
+// Copyright (c) 2026 ICHIRO ITS
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -18,17 +18,20 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#ifndef KEISAN__GEOMETRY__POINT_3_IMPL_HPP_
+#define KEISAN__GEOMETRY__POINT_3_IMPL_HPP_
+
 #include <cmath>
 
 #include "keisan/angle.hpp"
 #include "keisan/geometry/point_3.hpp"
 
-std::ostream & operator<<(std::ostream & out, const keisan::Point3 point)
+inline std::ostream & operator<<(std::ostream & out, const keisan::Point3 point)
 {
   return out << "{" << point.x << "," << point.y << "," << point.z << "}";
 }
 
-keisan::Point3 operator*(const double & value, const keisan::Point3 & point)
+constexpr keisan::Point3 operator*(const double & value, const keisan::Point3 & point)
 {
   return point * value;
 }
@@ -36,71 +39,53 @@ keisan::Point3 operator*(const double & value, const keisan::Point3 & point)
 namespace keisan
 {
 
-Point3::Point3()
-{
-}
-
-Point3::Point3(double x, double y, double z)
+constexpr Point3::Point3(double x, double y, double z)
 : x(x),
   y(y),
   z(z)
 {
 }
 
-Point3::Point3(const Vector<3> & vector)
+inline Point3::Point3(const Vector<3> & vector)
 : x(vector[0]),
   y(vector[1]),
   z(vector[2])
 {
 }
 
-Point3::Point3(const Vector<4> & vector)
+inline Point3::Point3(const Vector<4> & vector)
 : x(vector[0] / vector[3]),
   y(vector[1] / vector[3]),
   z(vector[2] / vector[3])
 {
 }
 
-Point3::Point3(const Point3 & point)
-{
-  *this = point;
-}
-
-Point3::operator Vector<3>() const
+inline Point3::operator Vector<3>() const
 {
   return Vector<3>(x, y, z);
 }
 
-Point3::operator Vector<4>() const
+inline Point3::operator Vector<4>() const
 {
   return Vector<4>(x, y, z, 1.0);
 }
 
-Point3 Point3::zero()
+constexpr Point3 Point3::zero()
 {
   return Point3(0.0, 0.0, 0.0);
 }
 
-Point3 & Point3::operator=(const Point3 & point)
-{
-  x = point.x;
-  y = point.y;
-  z = point.z;
-
-  return *this;
-}
-
-bool Point3::operator==(const Point3 & other) const
+constexpr bool Point3::operator==(const Point3 & other) const
 {
   return x == other.x && y == other.y && z == other.z;
 }
 
-bool Point3::operator!=(const Point3 & other) const
+constexpr bool Point3::operator!=(const Point3 & other) const
 {
   return x != other.x || y != other.y || z != other.z;
 }
 
-Point3 & Point3::operator+=(const Point3 & other)
+constexpr Point3 & Point3::operator+=(const Point3 & other)
 {
   x += other.x;
   y += other.y;
@@ -109,7 +94,7 @@ Point3 & Point3::operator+=(const Point3 & other)
   return *this;
 }
 
-Point3 & Point3::operator-=(const Point3 & other)
+constexpr Point3 & Point3::operator-=(const Point3 & other)
 {
   x -= other.x;
   y -= other.y;
@@ -118,7 +103,7 @@ Point3 & Point3::operator-=(const Point3 & other)
   return *this;
 }
 
-Point3 & Point3::operator+=(const double & value)
+constexpr Point3 & Point3::operator+=(const double & value)
 {
   x += value;
   y += value;
@@ -127,7 +112,7 @@ Point3 & Point3::operator+=(const double & value)
   return *this;
 }
 
-Point3 & Point3::operator-=(const double & value)
+constexpr Point3 & Point3::operator-=(const double & value)
 {
   x -= value;
   y -= value;
@@ -136,7 +121,7 @@ Point3 & Point3::operator-=(const double & value)
   return *this;
 }
 
-Point3 & Point3::operator*=(const double & value)
+constexpr Point3 & Point3::operator*=(const double & value)
 {
   x *= value;
   y *= value;
@@ -145,7 +130,7 @@ Point3 & Point3::operator*=(const double & value)
   return *this;
 }
 
-Point3 & Point3::operator/=(const double & value)
+constexpr Point3 & Point3::operator/=(const double & value)
 {
   x /= value;
   y /= value;
@@ -154,59 +139,59 @@ Point3 & Point3::operator/=(const double & value)
   return *this;
 }
 
-Point3 Point3::operator+(const Point3 & other) const
+constexpr Point3 Point3::operator+(const Point3 & other) const
 {
   return Point3(x + other.x, y + other.y, z + other.z);
 }
 
-Point3 Point3::operator-(const Point3 & other) const
+constexpr Point3 Point3::operator-(const Point3 & other) const
 {
   return Point3(x - other.x, y - other.y, z - other.z);
 }
 
-Point3 Point3::operator+(const double & value) const
+constexpr Point3 Point3::operator+(const double & value) const
 {
   return Point3(x + value, y + value, z + value);
 }
 
-Point3 Point3::operator-(const double & value) const
+constexpr Point3 Point3::operator-(const double & value) const
 {
   return Point3(x - value, y - value, z - value);
 }
 
-Point3 Point3::operator*(const double & value) const
+constexpr Point3 Point3::operator*(const double & value) const
 {
   return Point3(x * value, y * value, z * value);
 }
 
-Point3 Point3::operator/(const double & value) const
+constexpr Point3 Point3::operator/(const double & value) const
 {
   return Point3(x / value, y / value, z / value);
 }
 
-Point3 Point3::operator-() const
+constexpr Point3 Point3::operator-() const
 {
   return Point3(-x, -y, -z);
 }
 
-double Point3::magnitude() const
+inline double Point3::magnitude() const
 {
   return std::hypot(std::hypot(x, y), z);
 }
 
-Point3 Point3::normalize() const
+inline Point3 Point3::normalize() const
 {
   double mag = magnitude();
 
   return Point3(x / mag, y / mag, z / mag);
 }
 
-double Point3::dot(const Point3 & other) const
+constexpr double Point3::dot(const Point3 & other) const
 {
   return x * other.x + y * other.y + z * other.z;
 }
 
-Point3 Point3::cross(const Point3 & other) const
+constexpr Point3 Point3::cross(const Point3 & other) const
 {
   return Point3(
     y * other.z - z * other.y,
@@ -214,4 +199,15 @@ Point3 Point3::cross(const Point3 & other) const
     x * other.y - y * other.x);
 }
 
+inline Point3 Point3::rotate(const Quaternion<double> & rotation) const
+{
+  // v' = v + w * t + q x t, where t = 2 * (q x v).
+  Point3 axis(rotation.x, rotation.y, rotation.z);
+  Point3 twice_cross = axis.cross(*this) * 2.0;
+
+  return *this + twice_cross * rotation.w + axis.cross(twice_cross);
+}
+
 }  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__POINT_3_IMPL_HPP_
@@ -0,0 +1,108 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__POINT_CLOUD_2_HPP_
+#define KEISAN__GEOMETRY__POINT_CLOUD_2_HPP_
+
+#include <vector>
+
+#include "keisan/angle/angle.hpp"
+#include "keisan/angle/trigonometry.hpp"
+#include "keisan/geometry/aligned_vector.hpp"
+#include "keisan/geometry/point_2.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+// Structure of arrays storage for many Point2, every coordinate is kept in its own aligned
+// array so bulk operations run over contiguous values.
+class PointCloud2
+{
+public:
+  // Proxy to a single point inside the cloud, converts to and assigns from Point2.
+  struct Reference
+  {
+    operator Point2() const;
+    Reference & operator=(const Point2 & point);
+
+    double & x;
+    double & y;
+  };
+
+  PointCloud2() = default;
+  explicit PointCloud2(const std::vector<Point2> & points);
+
+  size_t size() const;
+  bool empty() const;
+
+  void reserve(size_t size);
+  void resize(size_t size);
+  void clear();
+
+  void push_back(const Point2 & point);
+
+  Reference operator[](size_t pos);
+  Point2 operator[](size_t pos) const;
+
+  std::vector<Point2> points() const;
+
+  const AlignedVector<double> & xs() const;
+  const AlignedVector<double> & ys() const;
+
+  // Writable coordinate arrays of size() elements, for filling a resized cloud in bulk.
+  double * x_data();
+  double * y_data();
+
+  void translate(const Point2 & translation);
+  void scale(const Point2 & scaling);
+  void scale(const double & scaling);
+  void rotate(const Angle<double> & rotation);
+
+  // Same as rotate(), for callers that already hold the sine and cosine of the rotation.
+  void rotate(double sin, double cos);
+
+  Point2 centroid() const;
+  Matrix<2, 2> covariance() const;
+
+  // Expects a non empty cloud.
+  void bounds(Point2 & min, Point2 & max) const;
+
+  // Index of the closest point, or size() for an empty cloud.
+  size_t nearest(const Point2 & point, double * squared_distance = nullptr) const;
+
+  void magnitudes(std::vector<double> & magnitudes) const;
+  void directions(std::vector<Angle<double>> & directions) const;
+
+  // Same as directions() through the polynomial arctangent of fast_signed_arctan(), within its
+  // precision.
+  template<Precision P = Precision::High>
+  void fast_directions(std::vector<Angle<double>> & directions) const;
+
+private:
+  AlignedVector<double> x_values;
+  AlignedVector<double> y_values;
+};
+
+}  // namespace keisan
+
+#include "keisan/geometry/point_cloud_2.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__POINT_CLOUD_2_HPP_
@@ -0,0 +1,279 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__POINT_CLOUD_2_IMPL_HPP_
+#define KEISAN__GEOMETRY__POINT_CLOUD_2_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "keisan/angle/trigonometry.hpp"
+#include "keisan/geometry/point_cloud_2.hpp"
+
+namespace keisan
+{
+
+inline PointCloud2::Reference::operator Point2() const
+{
+  return Point2(x, y);
+}
+
+inline PointCloud2::Reference & PointCloud2::Reference::operator=(const Point2 & point)
+{
+  x = point.x;
+  y = point.y;
+
+  return *this;
+}
+
+inline PointCloud2::PointCloud2(const std::vector<Point2> & points)
+: x_values(points.size()),
+  y_values(points.size())
+{
+  for (size_t i = 0; i < points.size(); ++i) {
+    x_values[i] = points[i].x;
+    y_values[i] = points[i].y;
+  }
+}
+
+inline size_t PointCloud2::size() const
+{
+  return x_values.size();
+}
+
+inline bool PointCloud2::empty() const
+{
+  return x_values.empty();
+}
+
+inline void PointCloud2::reserve(size_t size)
+{
+  x_values.reserve(size);
+  y_values.reserve(size);
+}
+
+inline void PointCloud2::resize(size_t size)
+{
+  x_values.resize(size);
+  y_values.resize(size);
+}
+
+inline void PointCloud2::clear()
+{
+  x_values.clear();
+  y_values.clear();
+}
+
+inline void PointCloud2::push_back(const Point2 & point)
+{
+  x_values.push_back(point.x);
+  y_values.push_back(point.y);
+}
+
+inline PointCloud2::Reference PointCloud2::operator[](size_t pos)
+{
+  return Reference{x_values[pos], y_values[pos]};
+}
+
+inline Point2 PointCloud2::operator[](size_t pos) const
+{
+  return Point2(x_values[pos], y_values[pos]);
+}
+
+inline std::vector<Point2> PointCloud2::points() const
+{
+  std::vector<Point2> points(size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    points[i] = Point2(x_values[i], y_values[i]);
+  }
+
+  return points;
+}
+
+inline const AlignedVector<double> & PointCloud2::xs() const
+{
+  return x_values;
+}
+
+inline const AlignedVector<double> & PointCloud2::ys() const
+{
+  return y_values;
+}
+
+inline double * PointCloud2::x_data()
+{
+  return x_values.data();
+}
+
+inline double * PointCloud2::y_data()
+{
+  return y_values.data();
+}
+
+inline void PointCloud2::translate(const Point2 & translation)
+{
+  double tx = translation.x;
+  double ty = translation.y;
+
+  double * xs = x_values.data();
+  double * ys = y_values.data();
+  for (size_t i = 0; i < size(); ++i) {
+    xs[i] += tx;
+    ys[i] += ty;
+  }
+}
+
+inline void PointCloud2::scale(const Point2 & scaling)
+{
+  double sx = scaling.x;
+  double sy = scaling.y;
+
+  double * xs = x_values.data();
+  double * ys = y_values.data();
+  for (size_t i = 0; i < size(); ++i) {
+    xs[i] *= sx;
+    ys[i] *= sy;
+  }
+}
+
+inline void PointCloud2::scale(const double & scaling)
+{
+  scale(Point2(scaling, scaling));
+}
+
+inline void PointCloud2::rotate(const Angle<double> & rotation)
+{
+  auto [sin, cos] = rotation.sincos();
+  rotate(sin, cos);
+}
+
+inline void PointCloud2::rotate(double sin, double cos)
+{
+  double * xs = x_values.data();
+  double * ys = y_values.data();
+  for (size_t i = 0; i < size(); ++i) {
+    double x = xs[i];
+    double y = ys[i];
+
+    xs[i] = x * cos - y * sin;
+    ys[i] = x * sin + y * cos;
+  }
+}
+
+inline Point2 PointCloud2::centroid() const
+{
+  double scale = 1.0 / size();
+
+  return Point2(
+    detail::lane_sum(x_values.data(), size()) * scale,
+    detail::lane_sum(y_values.data(), size()) * scale);
+}
+
+inline Matrix<2, 2> PointCloud2::covariance() const
+{
+  Point2 mean = centroid();
+  double scale = 1.0 / size();
+
+  const double * xs = x_values.data();
+  const double * ys = y_values.data();
+
+  double xx = detail::lane_centered_product(xs, mean.x, xs, mean.x, size()) * scale;
+  double xy = detail::lane_centered_product(xs, mean.x, ys, mean.y, size()) * scale;
+  double yy = detail::lane_centered_product(ys, mean.y, ys, mean.y, size()) * scale;
+
+  return Matrix<2, 2>(xx, xy, xy, yy);
+}
+
+inline void PointCloud2::bounds(Point2 & min, Point2 & max) const
+{
+  detail::lane_min_max(x_values.data(), size(), min.x, max.x);
+  detail::lane_min_max(y_values.data(), size(), min.y, max.y);
+}
+
+inline size_t PointCloud2::nearest(const Point2 & point, double * squared_distance) const
+{
+  double px = point.x;
+  double py = point.y;
+
+  const double * xs = x_values.data();
+  const double * ys = y_values.data();
+
+  // Squared distances are computed in bulk first, so the search itself is a plain min scan.
+  size_t best = size();
+  double best_distance = std::numeric_limits<double>::infinity();
+
+  constexpr size_t block_size = 256;
+  double distances[block_size];
+  for (size_t start = 0; start < size(); start += block_size) {
+    size_t count = std::min(block_size, size() - start);
+    for (size_t i = 0; i < count; ++i) {
+      double dx = xs[start + i] - px;
+      double dy = ys[start + i] - py;
+      distances[i] = dx * dx + dy * dy;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      if (distances[i] < best_distance) {
+        best_distance = distances[i];
+        best = start + i;
+      }
+    }
+  }
+
+  if (squared_distance) {
+    *squared_distance = best_distance;
+  }
+
+  return best;
+}
+
+inline void PointCloud2::magnitudes(std::vector<double> & magnitudes) const
+{
+  magnitudes.resize(size());
+
+  const double * xs = x_values.data();
+  const double * ys = y_values.data();
+  double * results = magnitudes.data();
+  for (size_t i = 0; i < size(); ++i) {
+    results[i] = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i]);
+  }
+}
+
+inline void PointCloud2::directions(std::vector<Angle<double>> & directions) const
+{
+  directions.resize(size());
+  for (size_t i = 0; i < size(); ++i) {
+    directions[i] = make_radian(std::atan2(y_values[i], x_values[i]));
+  }
+}
+
+template<Precision P>
+void PointCloud2::fast_directions(std::vector<Angle<double>> & directions) const
+{
+  directions.resize(size());
+  for (size_t i = 0; i < size(); ++i) {
+    directions[i] = make_radian(detail::atan2_radian<P, double>(y_values[i], x_values[i]));
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__POINT_CLOUD_2_IMPL_HPP_
@@ -0,0 +1,99 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__POINT_CLOUD_3_HPP_
+#define KEISAN__GEOMETRY__POINT_CLOUD_3_HPP_
+
+#include <vector>
+
+#include "keisan/angle/quaternion.hpp"
+#include "keisan/geometry/aligned_vector.hpp"
+#include "keisan/geometry/point_3.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+// Structure of arrays storage for many Point3, every coordinate is kept in its own aligned
+// array so bulk operations run over contiguous values.
+class PointCloud3
+{
+public:
+  // Proxy to a single point inside the cloud, converts to and assigns from Point3.
+  struct Reference
+  {
+    operator Point3() const;
+    Reference & operator=(const Point3 & point);
+
+    double & x;
+    double & y;
+    double & z;
+  };
+
+  PointCloud3() = default;
+  explicit PointCloud3(const std::vector<Point3> & points);
+
+  size_t size() const;
+  bool empty() const;
+
+  void reserve(size_t size);
+  void resize(size_t size);
+  void clear();
+
+  void push_back(const Point3 & point);
+
+  Reference operator[](size_t pos);
+  Point3 operator[](size_t pos) const;
+
+  std::vector<Point3> points() const;
+
+  const AlignedVector<double> & xs() const;
+  const AlignedVector<double> & ys() const;
+  const AlignedVector<double> & zs() const;
+
+  void translate(const Point3 & translation);
+  void scale(const Point3 & scaling);
+  void scale(const double & scaling);
+
+  // Expects a unit quaternion, same as Point3::rotate().
+  void rotate(const Quaternion<double> & rotation);
+
+  Point3 centroid() const;
+  Matrix<3, 3> covariance() const;
+
+  // Expects a non empty cloud.
+  void bounds(Point3 & min, Point3 & max) const;
+
+  // Index of the closest point, or size() for an empty cloud.
+  size_t nearest(const Point3 & point, double * squared_distance = nullptr) const;
+
+  void magnitudes(std::vector<double> & magnitudes) const;
+
+private:
+  AlignedVector<double> x_values;
+  AlignedVector<double> y_values;
+  AlignedVector<double> z_values;
+};
+
+}  // namespace keisan
+
+#include "keisan/geometry/point_cloud_3.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__POINT_CLOUD_3_HPP_
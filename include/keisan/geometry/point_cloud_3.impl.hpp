@@ -0,0 +1,289 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__POINT_CLOUD_3_IMPL_HPP_
+#define KEISAN__GEOMETRY__POINT_CLOUD_3_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "keisan/geometry/point_cloud_3.hpp"
+
+namespace keisan
+{
+
+inline PointCloud3::Reference::operator Point3() const
+{
+  return Point3(x, y, z);
+}
+
+inline PointCloud3::Reference & PointCloud3::Reference::operator=(const Point3 & point)
+{
+  x = point.x;
+  y = point.y;
+  z = point.z;
+
+  return *this;
+}
+
+inline PointCloud3::PointCloud3(const std::vector<Point3> & points)
+: x_values(points.size()),
+  y_values(points.size()),
+  z_values(points.size())
+{
+  for (size_t i = 0; i < points.size(); ++i) {
+    x_values[i] = points[i].x;
+    y_values[i] = points[i].y;
+    z_values[i] = points[i].z;
+  }
+}
+
+inline size_t PointCloud3::size() const
+{
+  return x_values.size();
+}
+
+inline bool PointCloud3::empty() const
+{
+  return x_values.empty();
+}
+
+inline void PointCloud3::reserve(size_t size)
+{
+  x_values.reserve(size);
+  y_values.reserve(size);
+  z_values.reserve(size);
+}
+
+inline void PointCloud3::resize(size_t size)
+{
+  x_values.resize(size);
+  y_values.resize(size);
+  z_values.resize(size);
+}
+
+inline void PointCloud3::clear()
+{
+  x_values.clear();
+  y_values.clear();
+  z_values.clear();
+}
+
+inline void PointCloud3::push_back(const Point3 & point)
+{
+  x_values.push_back(point.x);
+  y_values.push_back(point.y);
+  z_values.push_back(point.z);
+}
+
+inline PointCloud3::Reference PointCloud3::operator[](size_t pos)
+{
+  return Reference{x_values[pos], y_values[pos], z_values[pos]};
+}
+
+inline Point3 PointCloud3::operator[](size_t pos) const
+{
+  return Point3(x_values[pos], y_values[pos], z_values[pos]);
+}
+
+inline std::vector<Point3> PointCloud3::points() const
+{
+  std::vector<Point3> points(size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    points[i] = Point3(x_values[i], y_values[i], z_values[i]);
+  }
+
+  return points;
+}
+
+inline const AlignedVector<double> & PointCloud3::xs() const
+{
+  return x_values;
+}
+
+inline const AlignedVector<double> & PointCloud3::ys() const
+{
+  return y_values;
+}
+
+inline const AlignedVector<double> & PointCloud3::zs() const
+{
+  return z_values;
+}
+
+inline void PointCloud3::translate(const Point3 & translation)
+{
+  double tx = translation.x;
+  double ty = translation.y;
+  double tz = translation.z;
+
+  double * xs = x_values.data();
+  double * ys = y_values.data();
+  double * zs = z_values.data();
+  for (size_t i = 0; i < size(); ++i) {
+    xs[i] += tx;
+    ys[i] += ty;
+    zs[i] += tz;
+  }
+}
+
+inline void PointCloud3::scale(const Point3 & scaling)
+{
+  double sx = scaling.x;
+  double sy = scaling.y;
+  double sz = scaling.z;
+
+  double * xs = x_values.data();
+  double * ys = y_values.data();
+  double * zs = z_values.data();
+  for (size_t i = 0; i < size(); ++i) {
+    xs[i] *= sx;
+    ys[i] *= sy;
+    zs[i] *= sz;
+  }
+}
+
+inline void PointCloud3::scale(const double & scaling)
+{
+  scale(Point3(scaling, scaling, scaling));
+}
+
+inline void PointCloud3::rotate(const Quaternion<double> & rotation)
+{
+  double qx = rotation.x;
+  double qy = rotation.y;
+  double qz = rotation.z;
+  double qw = rotation.w;
+
+  double * xs = x_values.data();
+  double * ys = y_values.data();
+  double * zs = z_values.data();
+  for (size_t i = 0; i < size(); ++i) {
+    double x = xs[i];
+    double y = ys[i];
+    double z = zs[i];
+
+    // Same form as Point3::rotate(), v + w * t + q x t, where t = 2 * (q x v).
+    double tx = 2.0 * (qy * z - qz * y);
+    double ty = 2.0 * (qz * x - qx * z);
+    double tz = 2.0 * (qx * y - qy * x);
+
+    xs[i] = x + qw * tx + (qy * tz - qz * ty);
+    ys[i] = y + qw * ty + (qz * tx - qx * tz);
+    zs[i] = z + qw * tz + (qx * ty - qy * tx);
+  }
+}
+
+inline Point3 PointCloud3::centroid() const
+{
+  double scale = 1.0 / size();
+
+  return Point3(
+    detail::lane_sum(x_values.data(), size()) * scale,
+    detail::lane_sum(y_values.data(), size()) * scale,
+    detail::lane_sum(z_values.data(), size()) * scale);
+}
+
+inline Matrix<3, 3> PointCloud3::covariance() const
+{
+  Point3 mean = centroid();
+  double scale = 1.0 / size();
+
+  const double * xs = x_values.data();
+  const double * ys = y_values.data();
+  const double * zs = z_values.data();
+
+  double xx = detail::lane_centered_product(xs, mean.x, xs, mean.x, size()) * scale;
+  double xy = detail::lane_centered_product(xs, mean.x, ys, mean.y, size()) * scale;
+  double xz = detail::lane_centered_product(xs, mean.x, zs, mean.z, size()) * scale;
+  double yy = detail::lane_centered_product(ys, mean.y, ys, mean.y, size()) * scale;
+  double yz = detail::lane_centered_product(ys, mean.y, zs, mean.z, size()) * scale;
+  double zz = detail::lane_centered_product(zs, mean.z, zs, mean.z, size()) * scale;
+
+  return Matrix<3, 3>(
+    xx, xy, xz,
+    xy, yy, yz,
+    xz, yz, zz);
+}
+
+inline void PointCloud3::bounds(Point3 & min, Point3 & max) const
+{
+  detail::lane_min_max(x_values.data(), size(), min.x, max.x);
+  detail::lane_min_max(y_values.data(), size(), min.y, max.y);
+  detail::lane_min_max(z_values.data(), size(), min.z, max.z);
+}
+
+inline size_t PointCloud3::nearest(const Point3 & point, double * squared_distance) const
+{
+  double px = point.x;
+  double py = point.y;
+  double pz = point.z;
+
+  const double * xs = x_values.data();
+  const double * ys = y_values.data();
+  const double * zs = z_values.data();
+
+  // Squared distances are computed in bulk first, so the search itself is a plain min scan.
+  size_t best = size();
+  double best_distance = std::numeric_limits<double>::infinity();
+
+  constexpr size_t block_size = 256;
+  double distances[block_size];
+  for (size_t start = 0; start < size(); start += block_size) {
+    size_t count = std::min(block_size, size() - start);
+    for (size_t i = 0; i < count; ++i) {
+      double dx = xs[start + i] - px;
+      double dy = ys[start + i] - py;
+      double dz = zs[start + i] - pz;
+      distances[i] = dx * dx + dy * dy + dz * dz;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      if (distances[i] < best_distance) {
+        best_distance = distances[i];
+        best = start + i;
+      }
+    }
+  }
+
+  if (squared_distance) {
+    *squared_distance = best_distance;
+  }
+
+  return best;
+}
+
+inline void PointCloud3::magnitudes(std::vector<double> & magnitudes) const
+{
+  magnitudes.resize(size());
+
+  const double * xs = x_values.data();
+  const double * ys = y_values.data();
+  const double * zs = z_values.data();
+  double * results = magnitudes.data();
+  for (size_t i = 0; i < size(); ++i) {
+    results[i] = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i] + zs[i] * zs[i]);
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__POINT_CLOUD_3_IMPL_HPP_
@@ -0,0 +1,88 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__POSE_2_HPP_
+#define KEISAN__GEOMETRY__POSE_2_HPP_
+
+#include <vector>
+
+#include "keisan/angle/angle.hpp"
+#include "keisan/geometry/point_2.hpp"
+#include "keisan/geometry/point_cloud_2.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+// Rigid transformation on a plane, the cosine and sine of the orientation are kept alongside it
+// so composing and transforming never have to evaluate trigonometric functions.
+class Pose2
+{
+public:
+  Pose2();
+  Pose2(const Point2 & position, const Angle<double> & orientation);
+
+  static Pose2 identity();
+
+  bool operator==(const Pose2 & other) const;
+  bool operator!=(const Pose2 & other) const;
+
+  Pose2 & operator*=(const Pose2 & other);
+  Pose2 operator*(const Pose2 & other) const;
+
+  Pose2 inverse() const;
+
+  Point2 transform(const Point2 & point) const;
+  Point2 inverse_transform(const Point2 & point) const;
+
+  void transform(const std::vector<Point2> & points, std::vector<Point2> & results) const;
+  void transform(PointCloud2 & cloud) const;
+
+  Matrix<3, 3> matrix() const;
+
+  void set_position(const Point2 & position);
+  void set_orientation(const Angle<double> & orientation);
+
+  const Point2 & get_position() const;
+  Angle<double> get_orientation() const;
+
+  double get_cos() const;
+  double get_sin() const;
+
+private:
+  Pose2(const Point2 & position, double radian, double cos, double sin);
+
+  friend void compose(
+    const std::vector<Pose2> & poses, const Pose2 & delta, std::vector<Pose2> & results);
+
+  Point2 position;
+  double radian;
+  double cos;
+  double sin;
+};
+
+// Results in poses[i] * delta, e.g. to move every particle by the same odometry.
+void compose(const std::vector<Pose2> & poses, const Pose2 & delta, std::vector<Pose2> & results);
+
+}  // namespace keisan
+
+#include "keisan/geometry/pose_2.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__POSE_2_HPP_
@@ -0,0 +1,233 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__POSE_2_IMPL_HPP_
+#define KEISAN__GEOMETRY__POSE_2_IMPL_HPP_
+
+#include <vector>
+
+#include "keisan/constant.hpp"
+#include "keisan/geometry/pose_2.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// Sum of two normalized angles only needs a single period correction.
+inline double wrap_radian_sum(double radian)
+{
+  if (radian >= pi<double>) {
+    return radian - 2.0 * pi<double>;
+  } else if (radian < -pi<double>) {
+    return radian + 2.0 * pi<double>;
+  }
+
+  return radian;
+}
+
+// Rounding errors move the cached cosine and sine off the unit circle after many compositions,
+// a single Newton step on 1 / sqrt(c^2 + s^2) pulls them back.
+inline double unit_correction(double cos, double sin)
+{
+  return 1.5 - 0.5 * (cos * cos + sin * sin);
+}
+
+}  // namespace detail
+
+inline Pose2::Pose2()
+: position(0.0, 0.0),
+  radian(0.0),
+  cos(1.0),
+  sin(0.0)
+{
+}
+
+inline Pose2::Pose2(const Point2 & position, const Angle<double> & orientation)
+: position(position)
+{
+  set_orientation(orientation);
+}
+
+inline Pose2::Pose2(const Point2 & position, double radian, double cos, double sin)
+: position(position),
+  radian(radian),
+  cos(cos),
+  sin(sin)
+{
+}
+
+inline Pose2 Pose2::identity()
+{
+  return Pose2();
+}
+
+inline bool Pose2::operator==(const Pose2 & other) const
+{
+  return position == other.position && radian == other.radian;
+}
+
+inline bool Pose2::operator!=(const Pose2 & other) const
+{
+  return !(*this == other);
+}
+
+inline Pose2 & Pose2::operator*=(const Pose2 & other)
+{
+  *this = *this * other;
+
+  return *this;
+}
+
+inline Pose2 Pose2::operator*(const Pose2 & other) const
+{
+  double new_cos = cos * other.cos - sin * other.sin;
+  double new_sin = sin * other.cos + cos * other.sin;
+  double correction = detail::unit_correction(new_cos, new_sin);
+
+  return Pose2(
+    transform(other.position), detail::wrap_radian_sum(radian + other.radian),
+    new_cos * correction, new_sin * correction);
+}
+
+inline Pose2 Pose2::inverse() const
+{
+  return Pose2(
+    Point2(-(cos * position.x + sin * position.y), sin * position.x - cos * position.y),
+    radian == -pi<double> ? radian : -radian, cos, -sin);
+}
+
+inline Point2 Pose2::transform(const Point2 & point) const
+{
+  // Rotates before translating, in the same order as transform(PointCloud2) so the results match.
+  return Point2(
+    (point.x * cos - point.y * sin) + position.x,
+    (point.x * sin + point.y * cos) + position.y);
+}
+
+inline Point2 Pose2::inverse_transform(const Point2 & point) const
+{
+  double dx = point.x - position.x;
+  double dy = point.y - position.y;
+
+  return Point2(cos * dx + sin * dy, cos * dy - sin * dx);
+}
+
+inline void Pose2::transform(const std::vector<Point2> & points, std::vector<Point2> & results)
+const
+{
+  results.resize(points.size());
+
+  // Copied, so the compiler does not have to assume the results alias this pose.
+  double px = position.x;
+  double py = position.y;
+  double c = cos;
+  double s = sin;
+
+  const Point2 * sources = points.data();
+  Point2 * targets = results.data();
+  for (size_t i = 0; i < points.size(); ++i) {
+    double x = sources[i].x;
+    double y = sources[i].y;
+
+    targets[i].x = px + c * x - s * y;
+    targets[i].y = py + s * x + c * y;
+  }
+}
+
+inline void Pose2::transform(PointCloud2 & cloud) const
+{
+  cloud.rotate(sin, cos);
+  cloud.translate(position);
+}
+
+inline Matrix<3, 3> Pose2::matrix() const
+{
+  return Matrix<3, 3>(
+    cos, -sin, position.x,
+    sin, cos, position.y,
+    0.0, 0.0, 1.0);
+}
+
+inline void Pose2::set_position(const Point2 & position)
+{
+  this->position = position;
+}
+
+inline void Pose2::set_orientation(const Angle<double> & orientation)
+{
+  radian = orientation.normalize().radian();
+
+  auto [sin, cos] = orientation.sincos();
+  this->cos = cos;
+  this->sin = sin;
+}
+
+inline const Point2 & Pose2::get_position() const
+{
+  return position;
+}
+
+inline Angle<double> Pose2::get_orientation() const
+{
+  return make_radian(radian);
+}
+
+inline double Pose2::get_cos() const
+{
+  return cos;
+}
+
+inline double Pose2::get_sin() const
+{
+  return sin;
+}
+
+inline void compose(
+  const std::vector<Pose2> & poses, const Pose2 & delta, std::vector<Pose2> & results)
+{
+  results.resize(poses.size());
+
+  double dx = delta.position.x;
+  double dy = delta.position.y;
+  double dradian = delta.radian;
+  double dcos = delta.cos;
+  double dsin = delta.sin;
+
+  for (size_t i = 0; i < poses.size(); ++i) {
+    const Pose2 & pose = poses[i];
+
+    double new_cos = pose.cos * dcos - pose.sin * dsin;
+    double new_sin = pose.sin * dcos + pose.cos * dsin;
+    double correction = detail::unit_correction(new_cos, new_sin);
+
+    results[i] = Pose2(
+      Point2(
+        (dx * pose.cos - dy * pose.sin) + pose.position.x,
+        (dx * pose.sin + dy * pose.cos) + pose.position.y),
+      detail::wrap_radian_sum(pose.radian + dradian),
+      new_cos * correction, new_sin * correction);
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__POSE_2_IMPL_HPP_
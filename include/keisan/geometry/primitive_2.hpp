@@ -0,0 +1,138 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__PRIMITIVE_2_HPP_
+#define KEISAN__GEOMETRY__PRIMITIVE_2_HPP_
+
+#include <vector>
+
+#include "keisan/geometry/point_2.hpp"
+
+namespace keisan
+{
+
+// Infinite line passing through a point along a (not necessarily normalized) direction.
+struct Line2
+{
+  Line2() = default;
+  constexpr Line2(const Point2 & point, const Point2 & direction);
+
+  static constexpr Line2 from_points(const Point2 & a, const Point2 & b);
+
+  constexpr Point2 point_at(double t) const;
+
+  Point2 point;
+  Point2 direction;
+};
+
+struct Segment2
+{
+  Segment2() = default;
+  constexpr Segment2(const Point2 & start, const Point2 & end);
+
+  constexpr Point2 direction() const;
+  constexpr Point2 point_at(double t) const;
+
+  constexpr double squared_length() const;
+  double length() const;
+
+  Point2 start;
+  Point2 end;
+};
+
+struct Ray2
+{
+  Ray2() = default;
+  constexpr Ray2(const Point2 & origin, const Point2 & direction);
+
+  constexpr Point2 point_at(double t) const;
+
+  Point2 origin;
+  Point2 direction;
+};
+
+struct Circle2
+{
+  Circle2() = default;
+  constexpr Circle2(const Point2 & center, double radius);
+
+  constexpr bool contains(const Point2 & point) const;
+
+  Point2 center;
+  double radius;
+};
+
+struct Polygon2
+{
+  Polygon2() = default;
+  explicit Polygon2(const std::vector<Point2> & vertices);
+
+  // Positive for counterclockwise vertices.
+  double signed_area() const;
+  double area() const;
+
+  bool contains(const Point2 & point) const;
+
+  std::vector<Point2> vertices;
+};
+
+double squared_distance(const Line2 & line, const Point2 & point);
+double squared_distance(const Segment2 & segment, const Point2 & point);
+double squared_distance(const Ray2 & ray, const Point2 & point);
+
+// Zero for a point inside the polygon.
+double squared_distance(const Polygon2 & polygon, const Point2 & point);
+
+Point2 closest_point(const Line2 & line, const Point2 & point);
+Point2 closest_point(const Segment2 & segment, const Point2 & point);
+Point2 closest_point(const Ray2 & ray, const Point2 & point);
+
+// The intersection point is only computed, and the only division done, when requested.
+// Parallel lines and rays never intersect, even collinear ones, while collinear overlapping
+// segments do.
+bool intersect(const Line2 & a, const Line2 & b, Point2 * intersection = nullptr);
+bool intersect(const Line2 & line, const Segment2 & segment, Point2 * intersection = nullptr);
+bool intersect(const Segment2 & a, const Segment2 & b, Point2 * intersection = nullptr);
+bool intersect(const Ray2 & ray, const Segment2 & segment, Point2 * intersection = nullptr);
+
+// Intersection is the point where the ray enters the circle, or its origin if already inside.
+bool intersect(const Ray2 & ray, const Circle2 & circle, Point2 * intersection = nullptr);
+
+bool intersect(const Segment2 & segment, const Circle2 & circle);
+bool intersect(const Segment2 & segment, const Polygon2 & polygon);
+
+void squared_distances(
+  const Point2 & point, const std::vector<Segment2> & segments, std::vector<double> & results);
+
+// Parameters of the first hit along the ray for each segment, infinity for a miss.
+void intersect(
+  const Ray2 & ray, const std::vector<Segment2> & segments, std::vector<double> & parameters);
+
+// Indices of the segments or circles that intersect the segment.
+void intersect(
+  const Segment2 & segment, const std::vector<Segment2> & segments, std::vector<size_t> & indices);
+void intersect(
+  const Segment2 & segment, const std::vector<Circle2> & circles, std::vector<size_t> & indices);
+
+}  // namespace keisan
+
+#include "keisan/geometry/primitive_2.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__PRIMITIVE_2_HPP_
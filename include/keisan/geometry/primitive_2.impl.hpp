@@ -0,0 +1,519 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__PRIMITIVE_2_IMPL_HPP_
+#define KEISAN__GEOMETRY__PRIMITIVE_2_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "keisan/geometry/primitive_2.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// Solves start + t * r = other_start + u * s as t = t_numerator / denominator and
+// u = u_numerator / denominator, with the signs flipped so the denominator is never negative.
+struct CrossParameters
+{
+  CrossParameters(
+    const Point2 & start, const Point2 & r, const Point2 & other_start, const Point2 & s)
+  {
+    Point2 offset = other_start - start;
+
+    denominator = r.cross(s);
+    t_numerator = offset.cross(s);
+    u_numerator = offset.cross(r);
+
+    if (denominator < 0.0) {
+      denominator = -denominator;
+      t_numerator = -t_numerator;
+      u_numerator = -u_numerator;
+    }
+  }
+
+  bool is_within(double numerator) const
+  {
+    return numerator >= 0.0 && numerator <= denominator;
+  }
+
+  double denominator;
+  double t_numerator;
+  double u_numerator;
+};
+
+// Squared distance from start + t * direction to the point, for t in [0, 1] or t >= 0.
+inline double squared_distance(
+  const Point2 & start, const Point2 & direction, const Point2 & point, bool is_bounded)
+{
+  Point2 offset = point - start;
+
+  double t = offset.dot(direction);
+  if (t <= 0.0) {
+    return offset.dot(offset);
+  }
+
+  double squared_length = direction.dot(direction);
+  if (is_bounded && t >= squared_length) {
+    Point2 end_offset = offset - direction;
+    return end_offset.dot(end_offset);
+  }
+
+  double cross = direction.cross(offset);
+  return cross * cross / squared_length;
+}
+
+inline Point2 closest_point(
+  const Point2 & start, const Point2 & direction, const Point2 & point, bool is_bounded)
+{
+  double t = (point - start).dot(direction);
+  if (t <= 0.0) {
+    return start;
+  }
+
+  double squared_length = direction.dot(direction);
+  if (is_bounded && t >= squared_length) {
+    return start + direction;
+  }
+
+  return start + direction * (t / squared_length);
+}
+
+}  // namespace detail
+
+constexpr Line2::Line2(const Point2 & point, const Point2 & direction)
+: point(point),
+  direction(direction)
+{
+}
+
+constexpr Line2 Line2::from_points(const Point2 & a, const Point2 & b)
+{
+  return Line2(a, b - a);
+}
+
+constexpr Point2 Line2::point_at(double t) const
+{
+  return point + direction * t;
+}
+
+constexpr Segment2::Segment2(const Point2 & start, const Point2 & end)
+: start(start),
+  end(end)
+{
+}
+
+constexpr Point2 Segment2::direction() const
+{
+  return end - start;
+}
+
+constexpr Point2 Segment2::point_at(double t) const
+{
+  return start + direction() * t;
+}
+
+constexpr double Segment2::squared_length() const
+{
+  return direction().dot(direction());
+}
+
+inline double Segment2::length() const
+{
+  return std::sqrt(squared_length());
+}
+
+constexpr Ray2::Ray2(const Point2 & origin, const Point2 & direction)
+: origin(origin),
+  direction(direction)
+{
+}
+
+constexpr Point2 Ray2::point_at(double t) const
+{
+  return origin + direction * t;
+}
+
+constexpr Circle2::Circle2(const Point2 & center, double radius)
+: center(center),
+  radius(radius)
+{
+}
+
+constexpr bool Circle2::contains(const Point2 & point) const
+{
+  Point2 offset = point - center;
+  return offset.dot(offset) <= radius * radius;
+}
+
+inline Polygon2::Polygon2(const std::vector<Point2> & vertices)
+: vertices(vertices)
+{
+}
+
+inline double Polygon2::signed_area() const
+{
+  double sum = 0.0;
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    sum += vertices[j].cross(vertices[i]);
+  }
+
+  return sum * 0.5;
+}
+
+inline double Polygon2::area() const
+{
+  return std::abs(signed_area());
+}
+
+inline bool Polygon2::contains(const Point2 & point) const
+{
+  // Crossing number, with the edge crossing compared by multiplying instead of dividing.
+  bool inside = false;
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    const Point2 & a = vertices[i];
+    const Point2 & b = vertices[j];
+
+    if ((a.y > point.y) != (b.y > point.y)) {
+      double dy = b.y - a.y;
+      double side = (point.y - a.y) * (b.x - a.x) - (point.x - a.x) * dy;
+      if (side * dy > 0.0) {
+        inside = !inside;
+      }
+    }
+  }
+
+  return inside;
+}
+
+inline double squared_distance(const Line2 & line, const Point2 & point)
+{
+  Point2 offset = point - line.point;
+
+  double squared_length = line.direction.dot(line.direction);
+  if (squared_length == 0.0) {
+    return offset.dot(offset);
+  }
+
+  double cross = line.direction.cross(offset);
+  return cross * cross / squared_length;
+}
+
+inline double squared_distance(const Segment2 & segment, const Point2 & point)
+{
+  return detail::squared_distance(segment.start, segment.direction(), point, true);
+}
+
+inline double squared_distance(const Ray2 & ray, const Point2 & point)
+{
+  return detail::squared_distance(ray.origin, ray.direction, point, false);
+}
+
+inline double squared_distance(const Polygon2 & polygon, const Point2 & point)
+{
+  if (polygon.contains(point)) {
+    return 0.0;
+  }
+
+  double result = std::numeric_limits<double>::infinity();
+  const auto & vertices = polygon.vertices;
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    result = std::min(result, squared_distance(Segment2(vertices[j], vertices[i]), point));
+  }
+
+  return result;
+}
+
+inline Point2 closest_point(const Line2 & line, const Point2 & point)
+{
+  double squared_length = line.direction.dot(line.direction);
+  if (squared_length == 0.0) {
+    return line.point;
+  }
+
+  return line.point_at((point - line.point).dot(line.direction) / squared_length);
+}
+
+inline Point2 closest_point(const Segment2 & segment, const Point2 & point)
+{
+  return detail::closest_point(segment.start, segment.direction(), point, true);
+}
+
+inline Point2 closest_point(const Ray2 & ray, const Point2 & point)
+{
+  return detail::closest_point(ray.origin, ray.direction, point, false);
+}
+
+inline bool intersect(const Line2 & a, const Line2 & b, Point2 * intersection)
+{
+  detail::CrossParameters parameters(a.point, a.direction, b.point, b.direction);
+  if (parameters.denominator == 0.0) {
+    return false;
+  }
+
+  if (intersection) {
+    *intersection = a.point_at(parameters.t_numerator / parameters.denominator);
+  }
+
+  return true;
+}
+
+inline bool intersect(const Line2 & line, const Segment2 & segment, Point2 * intersection)
+{
+  detail::CrossParameters parameters(
+    line.point, line.direction, segment.start, segment.direction());
+
+  if (parameters.denominator == 0.0 || !parameters.is_within(parameters.u_numerator)) {
+    return false;
+  }
+
+  if (intersection) {
+    *intersection = segment.point_at(parameters.u_numerator / parameters.denominator);
+  }
+
+  return true;
+}
+
+inline bool intersect(const Segment2 & a, const Segment2 & b, Point2 * intersection)
+{
+  Point2 r = a.direction();
+  Point2 s = b.direction();
+
+  detail::CrossParameters parameters(a.start, r, b.start, s);
+
+  if (parameters.denominator == 0.0) {
+    if (parameters.u_numerator != 0.0) {
+      return false;
+    }
+
+    // Collinear, compare the projections of b on a scaled by the squared length of a.
+    double squared_length = r.dot(r);
+    if (squared_length == 0.0) {
+      if (squared_distance(b, a.start) != 0.0) {
+        return false;
+      }
+
+      if (intersection) {
+        *intersection = a.start;
+      }
+
+      return true;
+    }
+
+    double t0 = (b.start - a.start).dot(r);
+    double t1 = t0 + s.dot(r);
+
+    double low = std::max(std::min(t0, t1), 0.0);
+    double high = std::min(std::max(t0, t1), squared_length);
+    if (low > high) {
+      return false;
+    }
+
+    if (intersection) {
+      *intersection = a.point_at(low / squared_length);
+    }
+
+    return true;
+  }
+
+  if (!parameters.is_within(parameters.t_numerator) ||
+    !parameters.is_within(parameters.u_numerator))
+  {
+    return false;
+  }
+
+  if (intersection) {
+    *intersection = a.point_at(parameters.t_numerator / parameters.denominator);
+  }
+
+  return true;
+}
+
+inline bool intersect(const Ray2 & ray, const Segment2 & segment, Point2 * intersection)
+{
+  detail::CrossParameters parameters(ray.origin, ray.direction, segment.start, segment.direction());
+
+  if (parameters.denominator == 0.0 || parameters.t_numerator < 0.0 ||
+    !parameters.is_within(parameters.u_numerator))
+  {
+    return false;
+  }
+
+  if (intersection) {
+    *intersection = ray.point_at(parameters.t_numerator / parameters.denominator);
+  }
+
+  return true;
+}
+
+inline bool intersect(const Ray2 & ray, const Circle2 & circle, Point2 * intersection)
+{
+  Point2 offset = ray.origin - circle.center;
+
+  double b = offset.dot(ray.direction);
+  double c = offset.dot(offset) - circle.radius * circle.radius;
+
+  // Origin outside and pointing away.
+  if (c > 0.0 && b > 0.0) {
+    return false;
+  }
+
+  // A ray without direction is only its origin, which is outside the circle by now.
+  double a = ray.direction.dot(ray.direction);
+  if (a == 0.0 && c > 0.0) {
+    return false;
+  }
+
+  double discriminant = b * b - a * c;
+  if (discriminant < 0.0) {
+    return false;
+  }
+
+  if (intersection) {
+    if (c <= 0.0) {
+      *intersection = ray.origin;
+    } else {
+      *intersection = ray.point_at((-b - std::sqrt(discriminant)) / a);
+    }
+  }
+
+  return true;
+}
+
+inline bool intersect(const Segment2 & segment, const Circle2 & circle)
+{
+  return squared_distance(segment, circle.center) <= circle.radius * circle.radius;
+}
+
+inline bool intersect(const Segment2 & segment, const Polygon2 & polygon)
+{
+  if (polygon.contains(segment.start)) {
+    return true;
+  }
+
+  const auto & vertices = polygon.vertices;
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    if (intersect(segment, Segment2(vertices[j], vertices[i]))) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+inline void squared_distances(
+  const Point2 & point, const std::vector<Segment2> & segments, std::vector<double> & results)
+{
+  results.resize(segments.size());
+
+  double px = point.x;
+  double py = point.y;
+
+  // The clamped projections are stored first and turned into distances in a second pass, as a
+  // single loop has the clamp turned into branches that stop it from being vectorized.
+  const Segment2 * sources = segments.data();
+  double * targets = results.data();
+  for (size_t i = 0; i < segments.size(); ++i) {
+    double dx = sources[i].end.x - sources[i].start.x;
+    double dy = sources[i].end.y - sources[i].start.y;
+
+    // A degenerate segment gives NaN that clamps to 0.
+    double t = ((px - sources[i].start.x) * dx + (py - sources[i].start.y) * dy) /
+      (dx * dx + dy * dy);
+    t = t > 0.0 ? t : 0.0;
+    targets[i] = t < 1.0 ? t : 1.0;
+  }
+
+  for (size_t i = 0; i < segments.size(); ++i) {
+    double t = targets[i];
+    double ex = px - sources[i].start.x - (sources[i].end.x - sources[i].start.x) * t;
+    double ey = py - sources[i].start.y - (sources[i].end.y - sources[i].start.y) * t;
+    targets[i] = ex * ex + ey * ey;
+  }
+}
+
+inline void intersect(
+  const Ray2 & ray, const std::vector<Segment2> & segments, std::vector<double> & parameters)
+{
+  parameters.resize(segments.size());
+
+  double ox = ray.origin.x;
+  double oy = ray.origin.y;
+  double rx = ray.direction.x;
+  double ry = ray.direction.y;
+
+  const Segment2 * sources = segments.data();
+  double * targets = parameters.data();
+  for (size_t i = 0; i < segments.size(); ++i) {
+    double sx = sources[i].end.x - sources[i].start.x;
+    double sy = sources[i].end.y - sources[i].start.y;
+    double qx = sources[i].start.x - ox;
+    double qy = sources[i].start.y - oy;
+
+    double denominator = rx * sy - ry * sx;
+    double t_numerator = qx * sy - qy * sx;
+    double u_numerator = qx * ry - qy * rx;
+
+    // Parallel segments give infinity or NaN parameters that always fail the comparisons.
+    double t = t_numerator / denominator;
+    double u = u_numerator / denominator;
+
+    double parameter = t >= 0.0 ? t : std::numeric_limits<double>::infinity();
+    parameter = u >= 0.0 ? parameter : std::numeric_limits<double>::infinity();
+    parameter = u <= 1.0 ? parameter : std::numeric_limits<double>::infinity();
+
+    targets[i] = parameter;
+  }
+}
+
+inline void intersect(
+  const Segment2 & segment, const std::vector<Segment2> & segments, std::vector<size_t> & indices)
+{
+  indices.clear();
+  for (size_t i = 0; i < segments.size(); ++i) {
+    if (intersect(segment, segments[i])) {
+      indices.push_back(i);
+    }
+  }
+}
+
+inline void intersect(
+  const Segment2 & segment, const std::vector<Circle2> & circles, std::vector<size_t> & indices)
+{
+  indices.clear();
+
+  Point2 start = segment.start;
+  Point2 direction = segment.direction();
+  for (size_t i = 0; i < circles.size(); ++i) {
+    double radius = circles[i].radius;
+    if (detail::squared_distance(start, direction, circles[i].center, true) <= radius * radius) {
+      indices.push_back(i);
+    }
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__PRIMITIVE_2_IMPL_HPP_
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__PRIMITIVE_3_HPP_
+#define KEISAN__GEOMETRY__PRIMITIVE_3_HPP_
+
+#include "keisan/geometry/bounding_box.hpp"
+#include "keisan/geometry/point_3.hpp"
+
+namespace keisan
+{
+
+struct Segment3
+{
+  Segment3() = default;
+  constexpr Segment3(const Point3 & start, const Point3 & end);
+
+  constexpr Point3 direction() const;
+  constexpr Point3 point_at(double t) const;
+
+  constexpr double squared_length() const;
+  double length() const;
+
+  Aabb3 bounds() const;
+
+  Point3 start;
+  Point3 end;
+};
+
+struct Sphere3
+{
+  Sphere3() = default;
+  constexpr Sphere3(const Point3 & center, double radius);
+
+  constexpr bool contains(const Point3 & point) const;
+
+  Aabb3 bounds() const;
+
+  Point3 center;
+  double radius;
+};
+
+// Every point within the radius of a segment, a capsule of zero length is a sphere.
+struct Capsule3
+{
+  Capsule3() = default;
+  constexpr Capsule3(const Segment3 & segment, double radius);
+  constexpr Capsule3(const Point3 & start, const Point3 & end, double radius);
+  explicit constexpr Capsule3(const Sphere3 & sphere);
+
+  bool contains(const Point3 & point) const;
+
+  Aabb3 bounds() const;
+
+  Segment3 segment;
+  double radius;
+};
+
+double squared_distance(const Segment3 & segment, const Point3 & point);
+
+Point3 closest_point(const Segment3 & segment, const Point3 & point);
+
+// Squared distance between the closest points of two segments, found at the parameters s along a
+// and t along b when requested. Also handles segments of zero length and (nearly) parallel ones.
+double squared_distance(
+  const Segment3 & a, const Segment3 & b, double * s = nullptr, double * t = nullptr);
+
+// Touching shapes are intersecting.
+bool intersect(const Sphere3 & a, const Sphere3 & b);
+bool intersect(const Capsule3 & capsule, const Sphere3 & sphere);
+bool intersect(const Capsule3 & a, const Capsule3 & b);
+
+}  // namespace keisan
+
+#include "keisan/geometry/primitive_3.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__PRIMITIVE_3_HPP_
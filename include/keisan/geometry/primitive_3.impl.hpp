@@ -0,0 +1,215 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__PRIMITIVE_3_IMPL_HPP_
+#define KEISAN__GEOMETRY__PRIMITIVE_3_IMPL_HPP_
+
+#include <cmath>
+
+#include "keisan/geometry/primitive_3.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+constexpr double clamp_unit(double value)
+{
+  return value < 0.0 ? 0.0 : (value > 1.0 ? 1.0 : value);
+}
+
+}  // namespace detail
+
+constexpr Segment3::Segment3(const Point3 & start, const Point3 & end)
+: start(start),
+  end(end)
+{
+}
+
+constexpr Point3 Segment3::direction() const
+{
+  return end - start;
+}
+
+constexpr Point3 Segment3::point_at(double t) const
+{
+  return start + direction() * t;
+}
+
+constexpr double Segment3::squared_length() const
+{
+  return direction().dot(direction());
+}
+
+inline double Segment3::length() const
+{
+  return std::sqrt(squared_length());
+}
+
+inline Aabb3 Segment3::bounds() const
+{
+  return Aabb3(start, start).merge(end);
+}
+
+constexpr Sphere3::Sphere3(const Point3 & center, double radius)
+: center(center),
+  radius(radius)
+{
+}
+
+constexpr bool Sphere3::contains(const Point3 & point) const
+{
+  Point3 offset = point - center;
+  return offset.dot(offset) <= radius * radius;
+}
+
+inline Aabb3 Sphere3::bounds() const
+{
+  return Aabb3(center, center).expand(radius);
+}
+
+constexpr Capsule3::Capsule3(const Segment3 & segment, double radius)
+: segment(segment),
+  radius(radius)
+{
+}
+
+constexpr Capsule3::Capsule3(const Point3 & start, const Point3 & end, double radius)
+: segment(start, end),
+  radius(radius)
+{
+}
+
+constexpr Capsule3::Capsule3(const Sphere3 & sphere)
+: segment(sphere.center, sphere.center),
+  radius(sphere.radius)
+{
+}
+
+inline bool Capsule3::contains(const Point3 & point) const
+{
+  return squared_distance(segment, point) <= radius * radius;
+}
+
+inline Aabb3 Capsule3::bounds() const
+{
+  return segment.bounds().expand(radius);
+}
+
+inline double squared_distance(const Segment3 & segment, const Point3 & point)
+{
+  Point3 offset = point - closest_point(segment, point);
+  return offset.dot(offset);
+}
+
+inline Point3 closest_point(const Segment3 & segment, const Point3 & point)
+{
+  Point3 direction = segment.direction();
+
+  double t = (point - segment.start).dot(direction);
+  if (t <= 0.0) {
+    return segment.start;
+  }
+
+  double squared_length = direction.dot(direction);
+  if (t >= squared_length) {
+    return segment.end;
+  }
+
+  return segment.start + direction * (t / squared_length);
+}
+
+inline double squared_distance(const Segment3 & a, const Segment3 & b, double * s, double * t)
+{
+  Point3 d1 = a.direction();
+  Point3 d2 = b.direction();
+  Point3 r = a.start - b.start;
+
+  double length_a = d1.dot(d1);
+  double length_b = d2.dot(d2);
+  double f = d2.dot(r);
+
+  double sa = 0.0;
+  double tb = 0.0;
+
+  if (length_a == 0.0 && length_b == 0.0) {
+    // Both are points.
+  } else if (length_a == 0.0) {
+    tb = detail::clamp_unit(f / length_b);
+  } else {
+    double c = d1.dot(r);
+    if (length_b == 0.0) {
+      sa = detail::clamp_unit(-c / length_a);
+    } else {
+      // Minimizes over the infinite lines first, then clamps t and recomputes s for it. A
+      // denominator lost to cancellation means the lines are parallel, where any s works.
+      double b_dot = d1.dot(d2);
+      double denominator = length_a * length_b - b_dot * b_dot;
+      if (denominator > 1e-12 * length_a * length_b) {
+        sa = detail::clamp_unit((b_dot * f - c * length_b) / denominator);
+      }
+
+      tb = (b_dot * sa + f) / length_b;
+      if (tb < 0.0) {
+        tb = 0.0;
+        sa = detail::clamp_unit(-c / length_a);
+      } else if (tb > 1.0) {
+        tb = 1.0;
+        sa = detail::clamp_unit((b_dot - c) / length_a);
+      }
+    }
+  }
+
+  if (s) {
+    *s = sa;
+  }
+
+  if (t) {
+    *t = tb;
+  }
+
+  Point3 offset = (a.start + d1 * sa) - (b.start + d2 * tb);
+  return offset.dot(offset);
+}
+
+inline bool intersect(const Sphere3 & a, const Sphere3 & b)
+{
+  Point3 offset = a.center - b.center;
+  double radius = a.radius + b.radius;
+
+  return offset.dot(offset) <= radius * radius;
+}
+
+inline bool intersect(const Capsule3 & capsule, const Sphere3 & sphere)
+{
+  double radius = capsule.radius + sphere.radius;
+  return squared_distance(capsule.segment, sphere.center) <= radius * radius;
+}
+
+inline bool intersect(const Capsule3 & a, const Capsule3 & b)
+{
+  double radius = a.radius + b.radius;
+  return squared_distance(a.segment, b.segment) <= radius * radius;
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__PRIMITIVE_3_IMPL_HPP_
@@ -0,0 +1,128 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__RANSAC_HPP_
+#define KEISAN__GEOMETRY__RANSAC_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "keisan/geometry/point_2.hpp"
+#include "keisan/geometry/point_3.hpp"
+
+namespace keisan
+{
+
+// A model used by Ransac provides the Point type and sample_size, fit_sample() to create the model
+// from sample_size points, squared_error() of a single point, and refine() to fit the model on
+// its inliers with least squares. fit_sample() and refine() return false on degenerate input.
+
+// Line through a point along a unit direction.
+struct LineModel2
+{
+  using Point = Point2;
+  static constexpr size_t sample_size = 2;
+
+  bool fit_sample(const Point2 * samples);
+  double squared_error(const Point2 & point) const;
+  bool refine(const std::vector<Point2> & points, const std::vector<size_t> & inliers);
+
+  Point2 point;
+  Point2 direction;
+};
+
+struct CircleModel2
+{
+  using Point = Point2;
+  static constexpr size_t sample_size = 3;
+
+  bool fit_sample(const Point2 * samples);
+  double squared_error(const Point2 & point) const;
+  bool refine(const std::vector<Point2> & points, const std::vector<size_t> & inliers);
+
+  Point2 center;
+  double radius;
+};
+
+// Points where normal.dot(point) + offset is zero, with a unit normal.
+struct PlaneModel3
+{
+  using Point = Point3;
+  static constexpr size_t sample_size = 3;
+
+  bool fit_sample(const Point3 * samples);
+  double squared_error(const Point3 & point) const;
+  bool refine(const std::vector<Point3> & points, const std::vector<size_t> & inliers);
+
+  Point3 normal;
+  double offset;
+};
+
+template<typename Model>
+class Ransac
+{
+public:
+  using Point = typename Model::Point;
+
+  explicit Ransac(
+    double threshold, double confidence = 0.99, size_t max_iterations = 1000, uint64_t seed = 0);
+
+  // Stops early once this ratio of the points are inliers, 1 by default.
+  void set_stop_ratio(double ratio);
+
+  // Searches for the model with the most inliers, then refines it on them. Returns false when no
+  // sample gives a valid model. Apart from the first call, or a larger input, it does not allocate.
+  bool fit(const std::vector<Point> & points, Model & model);
+
+  const std::vector<size_t> & get_inliers() const;
+  size_t get_iterations() const;
+
+  // Thread-safe building blocks of fit(), which only read the points and the settings. Ransac
+  // itself never spawns threads, fit() scores the hypotheses one after another.
+
+  // Model from the sample of the given iteration, always the same for the same seed.
+  bool hypothesis(const std::vector<Point> & points, size_t iteration, Model & model) const;
+
+  // Inliers within [begin, end), stops early once it can no longer exceed the given count.
+  size_t count_inliers(
+    const Model & model, const std::vector<Point> & points, size_t begin, size_t end,
+    size_t to_exceed = 0) const;
+
+  // Iterations needed to pick an all inlier sample with the configured confidence.
+  size_t required_iterations(size_t inlier_count, size_t point_count) const;
+
+private:
+  void collect_inliers(const Model & model, const std::vector<Point> & points);
+
+  double squared_threshold;
+  double confidence;
+  size_t max_iterations;
+  uint64_t seed;
+  double stop_ratio;
+
+  std::vector<size_t> inliers;
+  size_t iterations;
+};
+
+}  // namespace keisan
+
+#include "keisan/geometry/ransac.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__RANSAC_HPP_
@@ -0,0 +1,417 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__RANSAC_IMPL_HPP_
+#define KEISAN__GEOMETRY__RANSAC_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "keisan/geometry/ransac.hpp"
+#include "keisan/matrix/matrix.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// SplitMix64, small enough to seed a fresh generator for every hypothesis.
+inline uint64_t splitmix64(uint64_t & state)
+{
+  uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+
+  return z ^ (z >> 31);
+}
+
+}  // namespace detail
+
+inline bool LineModel2::fit_sample(const Point2 * samples)
+{
+  Point2 difference = samples[1] - samples[0];
+
+  double length = difference.magnitude();
+  if (length == 0.0) {
+    return false;
+  }
+
+  point = samples[0];
+  direction = difference / length;
+
+  return true;
+}
+
+inline double LineModel2::squared_error(const Point2 & point) const
+{
+  double distance = direction.cross(point - this->point);
+  return distance * distance;
+}
+
+inline bool LineModel2::refine(
+  const std::vector<Point2> & points, const std::vector<size_t> & inliers)
+{
+  if (inliers.size() < sample_size) {
+    return false;
+  }
+
+  Point2 mean(0.0, 0.0);
+  for (auto index : inliers) {
+    mean += points[index];
+  }
+
+  mean /= inliers.size();
+
+  double xx = 0.0;
+  double xy = 0.0;
+  double yy = 0.0;
+  for (auto index : inliers) {
+    Point2 offset = points[index] - mean;
+    xx += offset.x * offset.x;
+    xy += offset.x * offset.y;
+    yy += offset.y * offset.y;
+  }
+
+  if (xx + yy == 0.0) {
+    return false;
+  }
+
+  // Principal axis of the covariance.
+  double angle = 0.5 * std::atan2(2.0 * xy, xx - yy);
+
+  point = mean;
+  direction = Point2(std::cos(angle), std::sin(angle));
+
+  return true;
+}
+
+inline bool CircleModel2::fit_sample(const Point2 * samples)
+{
+  Point2 ab = samples[1] - samples[0];
+  Point2 ac = samples[2] - samples[0];
+
+  double denominator = 2.0 * ab.cross(ac);
+  if (denominator == 0.0) {
+    return false;
+  }
+
+  double ab_squared = ab.dot(ab);
+  double ac_squared = ac.dot(ac);
+  Point2 offset(
+    (ac.y * ab_squared - ab.y * ac_squared) / denominator,
+    (ab.x * ac_squared - ac.x * ab_squared) / denominator);
+
+  center = samples[0] + offset;
+  radius = offset.magnitude();
+
+  return true;
+}
+
+inline double CircleModel2::squared_error(const Point2 & point) const
+{
+  double error = (point - center).magnitude() - radius;
+  return error * error;
+}
+
+inline bool CircleModel2::refine(
+  const std::vector<Point2> & points, const std::vector<size_t> & inliers)
+{
+  if (inliers.size() < sample_size) {
+    return false;
+  }
+
+  Point2 mean(0.0, 0.0);
+  for (auto index : inliers) {
+    mean += points[index];
+  }
+
+  mean /= inliers.size();
+
+  // Algebraic (Kasa) fit of u^2 + v^2 + d * u + e * v + f = 0 around the mean.
+  Matrix<3, 3> normal = Matrix<3, 3>::zero();
+  Vector<3> right = Vector<3>::zero();
+  for (auto index : inliers) {
+    Point2 offset = points[index] - mean;
+    double squared = offset.dot(offset);
+    double terms[3] = {offset.x, offset.y, 1.0};
+
+    for (size_t i = 0; i < 3; ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        normal[i][j] += terms[i] * terms[j];
+      }
+
+      right[i] -= terms[i] * squared;
+    }
+  }
+
+  Vector<3> solution;
+  if (!detail::solve_3x3(normal, right, solution)) {
+    return false;
+  }
+  Point2 offset(-0.5 * solution[0], -0.5 * solution[1]);
+
+  double squared_radius = offset.dot(offset) - solution[2];
+  if (!(squared_radius > 0.0)) {
+    return false;
+  }
+
+  center = mean + offset;
+  radius = std::sqrt(squared_radius);
+
+  return true;
+}
+
+inline bool PlaneModel3::fit_sample(const Point3 * samples)
+{
+  Point3 cross = (samples[1] - samples[0]).cross(samples[2] - samples[0]);
+
+  double length = cross.magnitude();
+  if (length == 0.0) {
+    return false;
+  }
+
+  normal = cross / length;
+  offset = -normal.dot(samples[0]);
+
+  return true;
+}
+
+inline double PlaneModel3::squared_error(const Point3 & point) const
+{
+  double distance = normal.dot(point) + offset;
+  return distance * distance;
+}
+
+inline bool PlaneModel3::refine(
+  const std::vector<Point3> & points, const std::vector<size_t> & inliers)
+{
+  if (inliers.size() < sample_size) {
+    return false;
+  }
+
+  Point3 mean(0.0, 0.0, 0.0);
+  for (auto index : inliers) {
+    mean += points[index];
+  }
+
+  mean /= inliers.size();
+
+  Matrix<3, 3> covariance = Matrix<3, 3>::zero();
+  for (auto index : inliers) {
+    Point3 offset = points[index] - mean;
+    double terms[3] = {offset.x, offset.y, offset.z};
+
+    for (size_t i = 0; i < 3; ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        covariance[i][j] += terms[i] * terms[j];
+      }
+    }
+  }
+
+  // The normal is the direction of least spread, the eigenvector of the smallest eigenvalue.
+  Vector<3> eigenvalues;
+  Matrix<3, 3> eigenvectors;
+  covariance.symmetric_eigen(eigenvalues, eigenvectors);
+
+  if (eigenvalues[1] <= 0.0) {
+    return false;
+  }
+
+  normal = Point3(eigenvectors[0][2], eigenvectors[1][2], eigenvectors[2][2]);
+  offset = -normal.dot(mean);
+
+  return true;
+}
+
+template<typename Model>
+Ransac<Model>::Ransac(
+  double threshold, double confidence, size_t max_iterations, uint64_t seed)
+: squared_threshold(threshold * threshold),
+  confidence(confidence),
+  max_iterations(max_iterations),
+  seed(seed),
+  stop_ratio(1.0),
+  iterations(0)
+{
+  if (!(threshold > 0.0)) {
+    throw std::invalid_argument("threshold must be positive");
+  }
+
+  if (!(confidence > 0.0 && confidence < 1.0)) {
+    throw std::invalid_argument("confidence must be between 0 and 1");
+  }
+}
+
+template<typename Model>
+void Ransac<Model>::set_stop_ratio(double ratio)
+{
+  stop_ratio = ratio;
+}
+
+template<typename Model>
+bool Ransac<Model>::fit(const std::vector<Point> & points, Model & model)
+{
+  inliers.clear();
+  iterations = 0;
+
+  if (points.size() < Model::sample_size) {
+    return false;
+  }
+
+  Model best;
+  size_t best_count = 0;
+  bool is_found = false;
+
+  size_t stop_count = std::ceil(stop_ratio * points.size());
+  size_t needed_iterations = max_iterations;
+
+  while (iterations < needed_iterations) {
+    Model candidate;
+    if (!hypothesis(points, iterations++, candidate)) {
+      continue;
+    }
+
+    size_t count = count_inliers(candidate, points, 0, points.size(), best_count);
+    if (!is_found || count > best_count) {
+      best = candidate;
+      best_count = count;
+      is_found = true;
+
+      needed_iterations = std::min(
+        needed_iterations, required_iterations(best_count, points.size()));
+
+      if (best_count >= stop_count) {
+        break;
+      }
+    }
+  }
+
+  if (!is_found) {
+    return false;
+  }
+
+  model = best;
+  collect_inliers(model, points);
+
+  // Only keep the refined model if it does not lose inliers.
+  Model refined = model;
+  if (refined.refine(points, inliers) &&
+    count_inliers(refined, points, 0, points.size()) >= inliers.size())
+  {
+    model = refined;
+    collect_inliers(model, points);
+  }
+
+  return true;
+}
+
+template<typename Model>
+const std::vector<size_t> & Ransac<Model>::get_inliers() const
+{
+  return inliers;
+}
+
+template<typename Model>
+size_t Ransac<Model>::get_iterations() const
+{
+  return iterations;
+}
+
+template<typename Model>
+bool Ransac<Model>::hypothesis(
+  const std::vector<Point> & points, size_t iteration, Model & model) const
+{
+  if (points.size() < Model::sample_size) {
+    return false;
+  }
+
+  uint64_t state = seed ^ (iteration * 0xD1B54A32D192ED03ull);
+
+  size_t indices[Model::sample_size];
+  Point samples[Model::sample_size];
+  for (size_t i = 0; i < Model::sample_size; ++i) {
+    bool is_taken;
+    do {
+      indices[i] = detail::splitmix64(state) % points.size();
+      is_taken = std::find(indices, indices + i, indices[i]) != indices + i;
+    } while (is_taken);
+
+    samples[i] = points[indices[i]];
+  }
+
+  return model.fit_sample(samples);
+}
+
+template<typename Model>
+size_t Ransac<Model>::count_inliers(
+  const Model & model, const std::vector<Point> & points, size_t begin, size_t end,
+  size_t to_exceed) const
+{
+  constexpr size_t block_size = 64;
+
+  size_t count = 0;
+  for (size_t block = begin; block < end; block += block_size) {
+    if (count + (end - block) <= to_exceed) {
+      break;
+    }
+
+    size_t block_end = std::min(block + block_size, end);
+    for (size_t i = block; i < block_end; ++i) {
+      count += model.squared_error(points[i]) <= squared_threshold ? 1 : 0;
+    }
+  }
+
+  return count;
+}
+
+template<typename Model>
+size_t Ransac<Model>::required_iterations(size_t inlier_count, size_t point_count) const
+{
+  double all_inlier = std::pow(
+    static_cast<double>(inlier_count) / point_count, static_cast<double>(Model::sample_size));
+
+  if (all_inlier >= 1.0) {
+    return 1;
+  } else if (all_inlier <= 0.0) {
+    return max_iterations;
+  }
+
+  double required = std::ceil(std::log(1.0 - confidence) / std::log(1.0 - all_inlier));
+  return std::min(static_cast<double>(max_iterations), std::max(required, 1.0));
+}
+
+template<typename Model>
+void Ransac<Model>::collect_inliers(const Model & model, const std::vector<Point> & points)
+{
+  inliers.clear();
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (model.squared_error(points[i]) <= squared_threshold) {
+      inliers.push_back(i);
+    }
+  }
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__RANSAC_IMPL_HPP_
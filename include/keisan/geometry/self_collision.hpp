@@ -0,0 +1,89 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__SELF_COLLISION_HPP_
+#define KEISAN__GEOMETRY__SELF_COLLISION_HPP_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "keisan/geometry/bounding_box.hpp"
+#include "keisan/geometry/dual_quaternion.hpp"
+#include "keisan/geometry/primitive_3.hpp"
+
+namespace keisan
+{
+
+// Collision shapes attached to the links of a robot, checked against each other for a pose given
+// as one transform per link. Pairs are found by sweep and prune over the world bounds along x,
+// the sorted order is kept between calls so the next, usually similar, pose sorts in about
+// linear time. Only the remaining pairs run the capsule distance test.
+class SelfCollision
+{
+public:
+  explicit SelfCollision(size_t link_count);
+
+  size_t get_link_count() const;
+  size_t shape_count() const;
+
+  // Shapes are given in the frame of their link, returns the index of the added shape.
+  size_t add_capsule(size_t link, const Capsule3 & capsule);
+  size_t add_sphere(size_t link, const Sphere3 & sphere);
+
+  // Shapes of the same link never collide, neighbouring links touching at their joint usually
+  // want to be ignored as well.
+  void ignore(size_t link_a, size_t link_b);
+
+  // Expects one transform per link, from the frame of the link to a frame shared by all of them.
+  bool collides(const std::vector<DualQuaternion<double>> & link_poses);
+
+  // Colliding shape indices, the lower one first, sorted.
+  bool collides(
+    const std::vector<DualQuaternion<double>> & link_poses,
+    std::vector<std::pair<size_t, size_t>> & pairs);
+
+  // Trajectory holds the link poses of every step one after another, results has one entry per
+  // step.
+  void collides_along(
+    const std::vector<DualQuaternion<double>> & trajectory, std::vector<bool> & results);
+
+private:
+  size_t add_shape(size_t link, const Capsule3 & capsule);
+
+  void update(const DualQuaternion<double> * link_poses);
+  bool sweep(std::vector<std::pair<size_t, size_t>> * pairs) const;
+
+  size_t link_count;
+  std::vector<uint8_t> ignored_links;
+
+  std::vector<Capsule3> shapes;
+  std::vector<size_t> shape_links;
+
+  std::vector<Capsule3> world_shapes;
+  std::vector<Aabb3> world_bounds;
+  std::vector<size_t> order;
+};
+
+}  // namespace keisan
+
+#include "keisan/geometry/self_collision.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__SELF_COLLISION_HPP_
@@ -0,0 +1,192 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__SELF_COLLISION_IMPL_HPP_
+#define KEISAN__GEOMETRY__SELF_COLLISION_IMPL_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "keisan/geometry/self_collision.hpp"
+
+namespace keisan
+{
+
+inline SelfCollision::SelfCollision(size_t link_count)
+: link_count(link_count),
+  ignored_links(link_count * link_count, 0)
+{
+  for (size_t i = 0; i < link_count; ++i) {
+    ignored_links[i * link_count + i] = 1;
+  }
+}
+
+inline size_t SelfCollision::get_link_count() const
+{
+  return link_count;
+}
+
+inline size_t SelfCollision::shape_count() const
+{
+  return shapes.size();
+}
+
+inline size_t SelfCollision::add_capsule(size_t link, const Capsule3 & capsule)
+{
+  return add_shape(link, capsule);
+}
+
+inline size_t SelfCollision::add_sphere(size_t link, const Sphere3 & sphere)
+{
+  return add_shape(link, Capsule3(sphere));
+}
+
+inline void SelfCollision::ignore(size_t link_a, size_t link_b)
+{
+  if (link_a >= link_count || link_b >= link_count) {
+    throw std::out_of_range("link index is out of range");
+  }
+
+  ignored_links[link_a * link_count + link_b] = 1;
+  ignored_links[link_b * link_count + link_a] = 1;
+}
+
+inline bool SelfCollision::collides(const std::vector<DualQuaternion<double>> & link_poses)
+{
+  if (link_poses.size() != link_count) {
+    throw std::invalid_argument("link poses must have one pose per link");
+  }
+
+  update(link_poses.data());
+  return sweep(nullptr);
+}
+
+inline bool SelfCollision::collides(
+  const std::vector<DualQuaternion<double>> & link_poses,
+  std::vector<std::pair<size_t, size_t>> & pairs)
+{
+  if (link_poses.size() != link_count) {
+    throw std::invalid_argument("link poses must have one pose per link");
+  }
+
+  pairs.clear();
+
+  update(link_poses.data());
+  sweep(&pairs);
+
+  std::sort(pairs.begin(), pairs.end());
+
+  return !pairs.empty();
+}
+
+inline void SelfCollision::collides_along(
+  const std::vector<DualQuaternion<double>> & trajectory, std::vector<bool> & results)
+{
+  if (link_count == 0 || trajectory.size() % link_count != 0) {
+    throw std::invalid_argument("trajectory must have one pose per link for every step");
+  }
+
+  size_t step_count = trajectory.size() / link_count;
+
+  results.resize(step_count);
+  for (size_t step = 0; step < step_count; ++step) {
+    update(trajectory.data() + step * link_count);
+    results[step] = sweep(nullptr);
+  }
+}
+
+inline size_t SelfCollision::add_shape(size_t link, const Capsule3 & capsule)
+{
+  if (link >= link_count) {
+    throw std::out_of_range("link index is out of range");
+  }
+
+  shapes.push_back(capsule);
+  shape_links.push_back(link);
+
+  world_shapes.resize(shapes.size());
+  world_bounds.resize(shapes.size());
+  order.push_back(shapes.size() - 1);
+
+  return shapes.size() - 1;
+}
+
+inline void SelfCollision::update(const DualQuaternion<double> * link_poses)
+{
+  for (size_t i = 0; i < shapes.size(); ++i) {
+    const auto & pose = link_poses[shape_links[i]];
+    const auto & segment = shapes[i].segment;
+
+    world_shapes[i] = Capsule3(
+      pose.transform(segment.start), pose.transform(segment.end), shapes[i].radius);
+    world_bounds[i] = world_shapes[i].bounds();
+  }
+
+  // Insertion sort, close to linear for the order left by a similar pose.
+  for (size_t i = 1; i < order.size(); ++i) {
+    size_t index = order[i];
+    double key = world_bounds[index].min.x;
+
+    size_t j = i;
+    for (; j > 0 && world_bounds[order[j - 1]].min.x > key; --j) {
+      order[j] = order[j - 1];
+    }
+
+    order[j] = index;
+  }
+}
+
+inline bool SelfCollision::sweep(std::vector<std::pair<size_t, size_t>> * pairs) const
+{
+  bool result = false;
+  for (size_t i = 0; i < order.size(); ++i) {
+    size_t a = order[i];
+    const uint8_t * ignored = ignored_links.data() + shape_links[a] * link_count;
+
+    for (size_t j = i + 1; j < order.size(); ++j) {
+      size_t b = order[j];
+      if (world_bounds[b].min.x > world_bounds[a].max.x) {
+        break;
+      }
+
+      if (ignored[shape_links[b]] || !overlap(world_bounds[a], world_bounds[b])) {
+        continue;
+      }
+
+      if (intersect(world_shapes[a], world_shapes[b])) {
+        if (!pairs) {
+          return true;
+        }
+
+        pairs->emplace_back(std::min(a, b), std::max(a, b));
+        result = true;
+      }
+    }
+  }
+
+  return result;
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__SELF_COLLISION_IMPL_HPP_
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__SPATIAL_HASH_2_HPP_
+#define KEISAN__GEOMETRY__SPATIAL_HASH_2_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "keisan/geometry/point_2.hpp"
+
+namespace keisan
+{
+
+// Points bucketed by the square cell they fall in, cells are hashed into a fixed number of
+// buckets so the covered area is unbounded. Each bucket is a chain of entries, build() lays the
+// chains out contiguously with a counting sort while insert() prepends to them.
+class SpatialHash2
+{
+public:
+  explicit SpatialHash2(double cell_size, size_t bucket_count = 4096);
+
+  double get_cell_size() const;
+  size_t bucket_count() const;
+
+  size_t size() const;
+  bool empty() const;
+
+  void reserve(size_t size);
+
+  // Does not release or touch the buckets.
+  void clear();
+
+  // Returns the index of the inserted point, counting on from the built points. Throws for a non
+  // finite point.
+  size_t insert(const Point2 & point);
+
+  // Replaces the content, indices refer to the given points. Throws for a non finite point, which
+  // leaves the content unspecified until the next build() or clear().
+  void build(const std::vector<Point2> & points);
+
+  // Same as build(), split in chunks that may run on different threads. Call prepare_build()
+  // first, then count_chunk() for every chunk, finish_count(), and scatter_chunk() for every
+  // chunk. Chunks of the same step do not share any data.
+  void prepare_build(size_t size, size_t chunk_count);
+  void count_chunk(const std::vector<Point2> & points, size_t chunk);
+  void finish_count();
+  void scatter_chunk(const std::vector<Point2> & points, size_t chunk);
+
+  // Every point within the radius, in no particular order. A radius covering more cells than
+  // there are buckets scans every point instead. Throws for a non finite point or radius.
+  void within(
+    const Point2 & point, double radius,
+    std::vector<size_t> & indices, std::vector<double> & squared_distances) const;
+
+private:
+  static constexpr uint32_t none = UINT32_MAX;
+
+  int64_t cell(double value) const;
+  size_t bucket(int64_t cell_x, int64_t cell_y) const;
+
+  size_t chunk_begin(size_t chunk) const;
+
+  double cell_size;
+  double inverse_cell_size;
+  size_t bucket_mask;
+
+  // A bucket head is only valid when its stamp matches the current one, so clearing is O(1).
+  std::vector<uint32_t> heads;
+  std::vector<uint32_t> head_stamps;
+  uint32_t stamp;
+
+  std::vector<Point2> entry_points;
+  std::vector<uint32_t> entry_indices;
+  std::vector<uint32_t> entry_nexts;
+
+  size_t build_chunk_count;
+  std::vector<uint32_t> build_buckets;
+  std::vector<uint32_t> build_offsets;
+};
+
+}  // namespace keisan
+
+#include "keisan/geometry/spatial_hash_2.impl.hpp"
+
+#endif  // KEISAN__GEOMETRY__SPATIAL_HASH_2_HPP_
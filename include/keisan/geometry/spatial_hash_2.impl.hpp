@@ -0,0 +1,292 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__GEOMETRY__SPATIAL_HASH_2_IMPL_HPP_
+#define KEISAN__GEOMETRY__SPATIAL_HASH_2_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "keisan/geometry/spatial_hash_2.hpp"
+
+namespace keisan
+{
+
+inline SpatialHash2::SpatialHash2(double cell_size, size_t bucket_count)
+: cell_size(cell_size),
+  inverse_cell_size(1.0 / cell_size),
+  bucket_mask(1),
+  stamp(1),
+  build_chunk_count(1)
+{
+  if (!(cell_size > 0.0)) {
+    throw std::invalid_argument("cell size must be positive");
+  }
+
+  size_t rounded_count = 2;
+  while (rounded_count < bucket_count) {
+    rounded_count *= 2;
+  }
+
+  bucket_mask = rounded_count - 1;
+  heads.resize(rounded_count);
+  head_stamps.resize(rounded_count, 0);
+}
+
+inline double SpatialHash2::get_cell_size() const
+{
+  return cell_size;
+}
+
+inline size_t SpatialHash2::bucket_count() const
+{
+  return heads.size();
+}
+
+inline size_t SpatialHash2::size() const
+{
+  return entry_points.size();
+}
+
+inline bool SpatialHash2::empty() const
+{
+  return entry_points.empty();
+}
+
+inline void SpatialHash2::reserve(size_t size)
+{
+  entry_points.reserve(size);
+  entry_indices.reserve(size);
+  entry_nexts.reserve(size);
+}
+
+inline void SpatialHash2::clear()
+{
+  entry_points.clear();
+  entry_indices.clear();
+  entry_nexts.clear();
+
+  // Only touch the stamps once every four billion clears, when the counter wraps around.
+  if (++stamp == 0) {
+    std::fill(head_stamps.begin(), head_stamps.end(), 0);
+    stamp = 1;
+  }
+}
+
+inline size_t SpatialHash2::insert(const Point2 & point)
+{
+  if (!std::isfinite(point.x) || !std::isfinite(point.y)) {
+    throw std::invalid_argument("point must be finite");
+  }
+
+  uint32_t position = size();
+  size_t index = bucket(cell(point.x), cell(point.y));
+
+  entry_points.push_back(point);
+  entry_indices.push_back(position);
+  entry_nexts.push_back(head_stamps[index] == stamp ? heads[index] : none);
+
+  heads[index] = position;
+  head_stamps[index] = stamp;
+
+  return position;
+}
+
+inline void SpatialHash2::build(const std::vector<Point2> & points)
+{
+  prepare_build(points.size(), 1);
+  count_chunk(points, 0);
+  finish_count();
+  scatter_chunk(points, 0);
+}
+
+inline void SpatialHash2::prepare_build(size_t size, size_t chunk_count)
+{
+  clear();
+
+  entry_points.resize(size);
+  entry_indices.resize(size);
+  entry_nexts.resize(size);
+
+  build_chunk_count = chunk_count > 0 ? chunk_count : 1;
+  build_buckets.resize(size);
+  build_offsets.assign(build_chunk_count * bucket_count(), 0);
+}
+
+inline void SpatialHash2::count_chunk(const std::vector<Point2> & points, size_t chunk)
+{
+  if (points.size() != size()) {
+    throw std::invalid_argument("points must have the prepared size");
+  }
+
+  uint32_t * counts = build_offsets.data() + chunk * bucket_count();
+  for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+    if (!std::isfinite(points[i].x) || !std::isfinite(points[i].y)) {
+      throw std::invalid_argument("points must be finite");
+    }
+
+    size_t index = bucket(cell(points[i].x), cell(points[i].y));
+
+    build_buckets[i] = index;
+    ++counts[index];
+  }
+}
+
+inline void SpatialHash2::finish_count()
+{
+  // Turns the counts into the positions each chunk starts writing at, bucket by bucket, and
+  // links the entries of each bucket in order.
+  uint32_t position = 0;
+  for (size_t index = 0; index < bucket_count(); ++index) {
+    uint32_t begin = position;
+    for (size_t chunk = 0; chunk < build_chunk_count; ++chunk) {
+      uint32_t & offset = build_offsets[chunk * bucket_count() + index];
+      uint32_t count = offset;
+
+      offset = position;
+      position += count;
+    }
+
+    if (position > begin) {
+      heads[index] = begin;
+      head_stamps[index] = stamp;
+
+      for (uint32_t i = begin; i + 1 < position; ++i) {
+        entry_nexts[i] = i + 1;
+      }
+
+      entry_nexts[position - 1] = none;
+    }
+  }
+}
+
+inline void SpatialHash2::scatter_chunk(const std::vector<Point2> & points, size_t chunk)
+{
+  if (points.size() != size()) {
+    throw std::invalid_argument("points must have the prepared size");
+  }
+
+  uint32_t * offsets = build_offsets.data() + chunk * bucket_count();
+  for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+    uint32_t position = offsets[build_buckets[i]]++;
+
+    entry_points[position] = points[i];
+    entry_indices[position] = i;
+  }
+}
+
+inline void SpatialHash2::within(
+  const Point2 & point, double radius,
+  std::vector<size_t> & indices, std::vector<double> & squared_distances) const
+{
+  indices.clear();
+  squared_distances.clear();
+
+  if (!std::isfinite(radius) || !std::isfinite(point.x) || !std::isfinite(point.y)) {
+    throw std::invalid_argument("point and radius must be finite");
+  }
+
+  if (empty() || radius < 0.0) {
+    return;
+  }
+
+  double squared_radius = radius * radius;
+
+  // Once the covered cells outnumber the buckets, most of them would hash to buckets that were
+  // already scanned, and the cell indices may not even fit in int64_t.
+  double span = 2.0 * radius * inverse_cell_size + 2.0;
+  if (span * span > static_cast<double>(bucket_count())) {
+    for (size_t i = 0; i < size(); ++i) {
+      double dx = entry_points[i].x - point.x;
+      double dy = entry_points[i].y - point.y;
+      double squared_distance = dx * dx + dy * dy;
+      if (squared_distance <= squared_radius) {
+        indices.push_back(entry_indices[i]);
+        squared_distances.push_back(squared_distance);
+      }
+    }
+
+    return;
+  }
+
+  int64_t min_x = cell(point.x - radius);
+  int64_t max_x = cell(point.x + radius);
+  int64_t min_y = cell(point.y - radius);
+  int64_t max_y = cell(point.y + radius);
+
+  for (int64_t cell_y = min_y; cell_y <= max_y; ++cell_y) {
+    for (int64_t cell_x = min_x; cell_x <= max_x; ++cell_x) {
+      size_t index = bucket(cell_x, cell_y);
+      if (head_stamps[index] != stamp) {
+        continue;
+      }
+
+      for (uint32_t i = heads[index]; i != none; i = entry_nexts[i]) {
+        const Point2 & other = entry_points[i];
+
+        // Other cells may share the bucket, they are visited on their own turn.
+        if (cell(other.x) != cell_x || cell(other.y) != cell_y) {
+          continue;
+        }
+
+        double dx = other.x - point.x;
+        double dy = other.y - point.y;
+        double squared_distance = dx * dx + dy * dy;
+        if (squared_distance <= squared_radius) {
+          indices.push_back(entry_indices[i]);
+          squared_distances.push_back(squared_distance);
+        }
+      }
+    }
+  }
+}
+
+inline int64_t SpatialHash2::cell(double value) const
+{
+  // Far away values share the outermost cells instead of overflowing the cast, the bound leaves
+  // room for the cell loops of within() to step past it. NaN ends up in the lowest cell.
+  constexpr double limit = 4611686018427387904.0;
+
+  double scaled = std::floor(value * inverse_cell_size);
+  scaled = (scaled < limit) ? scaled : limit;
+  scaled = (scaled > -limit) ? scaled : -limit;
+
+  return static_cast<int64_t>(scaled);
+}
+
+inline size_t SpatialHash2::bucket(int64_t cell_x, int64_t cell_y) const
+{
+  uint64_t hash = static_cast<uint64_t>(cell_x) * 0x9E3779B97F4A7C15ull ^
+    static_cast<uint64_t>(cell_y) * 0xC2B2AE3D27D4EB4Full;
+
+  return (hash ^ (hash >> 29)) & bucket_mask;
+}
+
+inline size_t SpatialHash2::chunk_begin(size_t chunk) const
+{
+  return chunk * size() / build_chunk_count;
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__GEOMETRY__SPATIAL_HASH_2_IMPL_HPP_
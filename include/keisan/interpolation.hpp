@@ -22,6 +22,7 @@
 #define KEISAN__INTERPOLATION_HPP_
 
 #include "keisan/interpolation/polynom.hpp"
+#include "keisan/interpolation/slerp.hpp"
 #include "keisan/interpolation/spline.hpp"
 
 #endif  // KEISAN__INTERPOLATION_HPP_
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__INTERPOLATION__SLERP_HPP_
+#define KEISAN__INTERPOLATION__SLERP_HPP_
+
+#include <vector>
+
+#include "keisan/angle/quaternion.hpp"
+
+namespace keisan
+{
+
+// All functions expect unit quaternions and interpolate along the shorter arc.
+
+template<typename T>
+Quaternion<T> nlerp(const Quaternion<T> & from, const Quaternion<T> & to, const T & t);
+
+template<typename T>
+void nlerp(
+  const Quaternion<T> & from, const Quaternion<T> & to, const std::vector<T> & ts,
+  std::vector<Quaternion<T>> & results);
+
+template<typename T>
+Quaternion<T> slerp(const Quaternion<T> & from, const Quaternion<T> & to, const T & t);
+
+template<typename T>
+void slerp(
+  const Quaternion<T> & from, const Quaternion<T> & to, const std::vector<T> & ts,
+  std::vector<Quaternion<T>> & results);
+
+// Inner control point of the keyframe current, given its neighboring keyframes.
+template<typename T>
+Quaternion<T> squad_control(
+  const Quaternion<T> & previous, const Quaternion<T> & current, const Quaternion<T> & next);
+
+template<typename T>
+Quaternion<T> squad(
+  const Quaternion<T> & from, const Quaternion<T> & from_control,
+  const Quaternion<T> & to_control, const Quaternion<T> & to, const T & t);
+
+}  // namespace keisan
+
+#include "keisan/interpolation/slerp.impl.hpp"
+
+#endif  // KEISAN__INTERPOLATION__SLERP_HPP_
@@ -0,0 +1,186 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef KEISAN__INTERPOLATION__SLERP_IMPL_HPP_
+#define KEISAN__INTERPOLATION__SLERP_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "keisan/interpolation/slerp.hpp"
+
+namespace keisan
+{
+
+namespace detail
+{
+
+// Beyond this cosine the arc is short enough that nlerp is indistinguishable from slerp,
+// while the sine of the angle becomes too small to divide by.
+constexpr double slerp_nlerp_threshold = 0.9995;
+
+template<typename T>
+Quaternion<T> scale_add(
+  const Quaternion<T> & a, const T & a_scale, const Quaternion<T> & b, const T & b_scale)
+{
+  return Quaternion<T>(
+    a.x * a_scale + b.x * b_scale, a.y * a_scale + b.y * b_scale,
+    a.z * a_scale + b.z * b_scale, a.w * a_scale + b.w * b_scale);
+}
+
+template<typename T>
+Quaternion<T> shortest_target(const Quaternion<T> & from, const Quaternion<T> & to)
+{
+  return (from.dot(to) < 0) ? -to : to;
+}
+
+// Precomputes the unit quaternion orthogonal to from within the plane of from and to,
+// so every t only costs one sine and cosine pair: from * cos(t * angle) + orthogonal * sin(t * angle).
+template<typename T>
+struct SlerpArc
+{
+  SlerpArc(const Quaternion<T> & from, const Quaternion<T> & to)
+  : from(from), to(to), orthogonal(to), angle(0), is_linear(true)
+  {
+    T cosine = from.dot(to);
+    if (cosine < slerp_nlerp_threshold) {
+      T sine = std::sqrt(std::max<T>(1 - cosine * cosine, 0));
+
+      // Antipodal ends leave the plane undefined, any quaternion orthogonal to from gives a
+      // half turn arc that ends at to.
+      if (sine <= std::sqrt(std::numeric_limits<T>::epsilon())) {
+        orthogonal = Quaternion<T>(-from.y, from.x, -from.w, from.z);
+        angle = std::acos(T(-1));
+      } else {
+        orthogonal = scale_add(to, 1 / sine, from, -cosine / sine);
+        angle = std::atan2(sine, cosine);
+      }
+
+      is_linear = false;
+    }
+  }
+
+  Quaternion<T> operator()(const T & t) const
+  {
+    if (is_linear) {
+      return scale_add(from, 1 - t, to, t).normalize();
+    }
+
+    return scale_add(from, std::cos(t * angle), orthogonal, std::sin(t * angle));
+  }
+
+  Quaternion<T> from;
+  Quaternion<T> to;
+  Quaternion<T> orthogonal;
+  T angle;
+  bool is_linear;
+};
+
+template<typename T>
+Quaternion<T> log(const Quaternion<T> & quaternion)
+{
+  T sine = std::sqrt(
+    quaternion.x * quaternion.x + quaternion.y * quaternion.y + quaternion.z * quaternion.z);
+
+  T scale = (sine > 0) ? std::atan2(sine, quaternion.w) / sine : 1;
+
+  return Quaternion<T>(quaternion.x * scale, quaternion.y * scale, quaternion.z * scale, 0);
+}
+
+template<typename T>
+Quaternion<T> exp(const Quaternion<T> & quaternion)
+{
+  T angle = std::sqrt(
+    quaternion.x * quaternion.x + quaternion.y * quaternion.y + quaternion.z * quaternion.z);
+
+  T scale = (angle > 0) ? std::sin(angle) / angle : 1;
+
+  return Quaternion<T>(
+    quaternion.x * scale, quaternion.y * scale, quaternion.z * scale, std::cos(angle));
+}
+
+}  // namespace detail
+
+template<typename T>
+Quaternion<T> nlerp(const Quaternion<T> & from, const Quaternion<T> & to, const T & t)
+{
+  return detail::scale_add(from, 1 - t, detail::shortest_target(from, to), t).normalize();
+}
+
+template<typename T>
+void nlerp(
+  const Quaternion<T> & from, const Quaternion<T> & to, const std::vector<T> & ts,
+  std::vector<Quaternion<T>> & results)
+{
+  Quaternion<T> target = detail::shortest_target(from, to);
+
+  results.resize(ts.size());
+  for (size_t i = 0; i < ts.size(); ++i) {
+    results[i] = detail::scale_add(from, 1 - ts[i], target, ts[i]).normalize();
+  }
+}
+
+template<typename T>
+Quaternion<T> slerp(const Quaternion<T> & from, const Quaternion<T> & to, const T & t)
+{
+  return detail::SlerpArc<T>(from, detail::shortest_target(from, to))(t);
+}
+
+template<typename T>
+void slerp(
+  const Quaternion<T> & from, const Quaternion<T> & to, const std::vector<T> & ts,
+  std::vector<Quaternion<T>> & results)
+{
+  detail::SlerpArc<T> arc(from, detail::shortest_target(from, to));
+
+  results.resize(ts.size());
+  for (size_t i = 0; i < ts.size(); ++i) {
+    results[i] = arc(ts[i]);
+  }
+}
+
+template<typename T>
+Quaternion<T> squad_control(
+  const Quaternion<T> & previous, const Quaternion<T> & current, const Quaternion<T> & next)
+{
+  Quaternion<T> inverse = current.conjugate();
+
+  Quaternion<T> to_previous = detail::log(inverse * detail::shortest_target(current, previous));
+  Quaternion<T> to_next = detail::log(inverse * detail::shortest_target(current, next));
+
+  return current * detail::exp(detail::scale_add(to_previous, T(-0.25), to_next, T(-0.25)));
+}
+
+template<typename T>
+Quaternion<T> squad(
+  const Quaternion<T> & from, const Quaternion<T> & from_control,
+  const Quaternion<T> & to_control, const Quaternion<T> & to, const T & t)
+{
+  // The inner interpolations must not flip hemisphere, otherwise the curve loses continuity.
+  Quaternion<T> outer = detail::SlerpArc<T>(from, to)(t);
+  Quaternion<T> inner = detail::SlerpArc<T>(from_control, to_control)(t);
+
+  return detail::SlerpArc<T>(outer, inner)(2 * t * (1 - t));
+}
+
+}  // namespace keisan
+
+#endif  // KEISAN__INTERPOLATION__SLERP_IMPL_HPP_
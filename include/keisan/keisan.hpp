@@ -21,8 +21,25 @@
 #ifndef KEISAN__KEISAN_HPP_
 #define KEISAN__KEISAN_HPP_
 
+#include "keisan/angle/quaternion_average.hpp"
+
+#include "keisan/geometry/bounding_box.hpp"
+#include "keisan/geometry/distance_field_2.hpp"
+#include "keisan/geometry/dual_quaternion.hpp"
+#include "keisan/geometry/homography.hpp"
+#include "keisan/geometry/icp_2.hpp"
+#include "keisan/geometry/kd_tree.hpp"
+#include "keisan/geometry/pinhole_camera.hpp"
 #include "keisan/geometry/point_2.hpp"
 #include "keisan/geometry/point_3.hpp"
+#include "keisan/geometry/point_cloud_2.hpp"
+#include "keisan/geometry/point_cloud_3.hpp"
+#include "keisan/geometry/pose_2.hpp"
+#include "keisan/geometry/primitive_2.hpp"
+#include "keisan/geometry/primitive_3.hpp"
+#include "keisan/geometry/ransac.hpp"
+#include "keisan/geometry/self_collision.hpp"
+#include "keisan/geometry/spatial_hash_2.hpp"
 
 #include "keisan/angle.hpp"
 #include "keisan/constant.hpp"
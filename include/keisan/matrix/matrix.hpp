@@ -25,6 +25,7 @@
 
 #include "keisan/angle/angle.hpp"
 #include "keisan/angle/euler.hpp"
+#include "keisan/angle/quaternion.hpp"
 #include "keisan/geometry/point_2.hpp"
 #include "keisan/geometry/point_3.hpp"
 #include "keisan/matrix/vector.hpp"
@@ -79,6 +80,10 @@ public:
 
   bool inverse();
   bool inverse2();
+  bool inverse3();
+
+  // Eigenvalues sorted in descending order, with the matching eigenvectors as columns.
+  void symmetric_eigen(Vector<M> & eigenvalues, Matrix<M, N> & eigenvectors) const;
 
   Matrix<N, M> transpose() const;
   Matrix<M, N> round(double tolerance) const;
@@ -95,6 +100,10 @@ Matrix<3, 3> rotation_matrix(const Angle<double> & angle);
 
 Matrix<4, 4> rotation_matrix(const Euler<double> & angle);
 
+Matrix<4, 4> rotation_matrix(const Quaternion<double> & quaternion);
+
+Quaternion<double> rotation_quaternion(const Matrix<4, 4> & matrix);
+
 }  // namespace keisan
 
 template<size_t M, size_t N>
@@ -22,7 +22,9 @@
 #define KEISAN__MATRIX__MATRIX_IMPL_HPP_
 
 #include <algorithm>
+#include <cmath>
 #include <ostream>
+#include <utility>
 
 #include "gtest/gtest.h"
 #include "keisan/matrix/matrix.hpp"
@@ -62,6 +64,27 @@ inline keisan::Matrix<M, N> operator*(const double & value, const keisan::Matrix
 namespace keisan
 {
 
+namespace detail
+{
+
+// Closed form through Matrix<3, 3>::inverse3, enough for the small normal equations of least
+// squares fits.
+inline bool solve_3x3(const Matrix<3, 3> & a, const Vector<3> & b, Vector<3> & x)
+{
+  auto inverse = a;
+  if (!inverse.inverse3()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < 3; ++i) {
+    x[i] = inverse[i][0] * b[0] + inverse[i][1] * b[1] + inverse[i][2] * b[2];
+  }
+
+  return true;
+}
+
+}  // namespace detail
+
 template <size_t M, size_t N>
 Matrix<M, N>::Matrix()
 {
@@ -326,6 +349,35 @@ bool Matrix<M, N>::inverse2()
   return true;
 }
 
+template <size_t M, size_t N>
+bool Matrix<M, N>::inverse3()
+{
+  static_assert(M == 3 && N == 3, "Inverse matrix operation only available for 3 by 3 matrix.");
+
+  auto inverse = Matrix<M, N>::zero();
+  auto source = *this;
+
+  // Adjugate, the first column of cofactors also gives the determinant.
+  inverse[0][0] = source[1][1] * source[2][2] - source[1][2] * source[2][1];
+  inverse[0][1] = source[0][2] * source[2][1] - source[0][1] * source[2][2];
+  inverse[0][2] = source[0][1] * source[1][2] - source[0][2] * source[1][1];
+  inverse[1][0] = source[1][2] * source[2][0] - source[1][0] * source[2][2];
+  inverse[1][1] = source[0][0] * source[2][2] - source[0][2] * source[2][0];
+  inverse[1][2] = source[0][2] * source[1][0] - source[0][0] * source[1][2];
+  inverse[2][0] = source[1][0] * source[2][1] - source[1][1] * source[2][0];
+  inverse[2][1] = source[0][1] * source[2][0] - source[0][0] * source[2][1];
+  inverse[2][2] = source[0][0] * source[1][1] - source[0][1] * source[1][0];
+
+  double determinant = source[0][0] * inverse[0][0] + source[0][1] * inverse[1][0] +
+    source[0][2] * inverse[2][0];
+  if (determinant == 0) {
+    return false;
+  }
+
+  (*this) = inverse * (1.0 / determinant);
+  return true;
+}
+
 template <size_t M, size_t N>
 bool Matrix<M, N>::inverse()
 {
@@ -431,6 +483,86 @@ bool Matrix<M, N>::inverse()
   return true;
 }
 
+template <size_t M, size_t N>
+void Matrix<M, N>::symmetric_eigen(Vector<M> & eigenvalues, Matrix<M, N> & eigenvectors) const
+{
+  static_assert(M == N, "Eigen decomposition only available for square matrix.");
+
+  auto matrix = *this;
+  eigenvectors = Matrix<M, N>::identity();
+
+  // Cyclic Jacobi, each rotation zeroes one off-diagonal pair.
+  for (int sweep = 0; sweep < 50; ++sweep) {
+    double off_diagonal = 0.0;
+    double diagonal = 0.0;
+    for (size_t p = 0; p < M; ++p) {
+      diagonal += matrix[p][p] * matrix[p][p];
+      for (size_t q = p + 1; q < M; ++q) {
+        off_diagonal += matrix[p][q] * matrix[p][q];
+      }
+    }
+
+    if (off_diagonal <= 1e-30 * diagonal || off_diagonal == 0.0) {
+      break;
+    }
+
+    for (size_t p = 0; p < M; ++p) {
+      for (size_t q = p + 1; q < M; ++q) {
+        if (matrix[p][q] == 0.0) {
+          continue;
+        }
+
+        double theta = (matrix[q][q] - matrix[p][p]) / (2.0 * matrix[p][q]);
+        double t = 1.0 / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+        t = (theta < 0.0) ? -t : t;
+
+        double c = 1.0 / std::sqrt(t * t + 1.0);
+        double s = t * c;
+        double tau = s / (1.0 + c);
+
+        matrix[p][p] -= t * matrix[p][q];
+        matrix[q][q] += t * matrix[p][q];
+        matrix[p][q] = 0.0;
+        matrix[q][p] = 0.0;
+
+        for (size_t r = 0; r < M; ++r) {
+          if (r != p && r != q) {
+            double g = matrix[r][p];
+            double h = matrix[r][q];
+            matrix[r][p] = matrix[p][r] = g - s * (h + g * tau);
+            matrix[r][q] = matrix[q][r] = h + s * (g - h * tau);
+          }
+
+          double g = eigenvectors[r][p];
+          double h = eigenvectors[r][q];
+          eigenvectors[r][p] = g - s * (h + g * tau);
+          eigenvectors[r][q] = h + s * (g - h * tau);
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < M; ++i) {
+    eigenvalues[i] = matrix[i][i];
+  }
+
+  for (size_t i = 0; i < M; ++i) {
+    size_t largest = i;
+    for (size_t j = i + 1; j < M; ++j) {
+      if (eigenvalues[j] > eigenvalues[largest]) {
+        largest = j;
+      }
+    }
+
+    if (largest != i) {
+      std::swap(eigenvalues[i], eigenvalues[largest]);
+      for (size_t r = 0; r < M; ++r) {
+        std::swap(eigenvectors[r][i], eigenvectors[r][largest]);
+      }
+    }
+  }
+}
+
 template <size_t M, size_t N>
 Matrix<N, M> Matrix<M, N>::transpose() const
 {
@@ -21,7 +21,9 @@
 #ifndef KEISAN__NUMBER_HPP_
 #define KEISAN__NUMBER_HPP_
 
+#include <cstddef>
 #include <type_traits>
+#include <vector>
 
 namespace keisan
 {
@@ -71,6 +73,9 @@ T wrap(const T & value, const T & min, const T & max);
 template<typename T, enable_if_is_integral<T> = true>
 T wrap(const T & value, const T & min, const T & max);
 
+template<typename T>
+void wrap_all(std::vector<T> & values, const T & min, const T & max);
+
 template<typename T>
 T smooth(T value, T target, T ratio);
 
@@ -80,6 +85,28 @@ T curve(const T & value, const T & min, const T & max, const T & exponential);
 template<typename T>
 T lerp(const T & start, const T & end, const T & rate);
 
+namespace detail
+{
+
+template<typename T>
+bool is_within_period(const T & value, const T & min, const T & range);
+
+template<typename T>
+T wrap_within_period(const T & value, const T & min, const T & range);
+
+// Reductions keep independent partial results per lane, which lets the compiler vectorize
+// them without reassociating floating point additions itself.
+constexpr size_t reduction_lanes = 4;
+
+template<typename T>
+T lane_sum(const T * values, size_t size);
+
+// Sum of (a - a_offset) * (b - b_offset).
+template<typename T>
+T lane_centered_product(const T * a, T a_offset, const T * b, T b_offset, size_t size);
+
+}  // namespace detail
+
 }  // namespace keisan
 
 #include "keisan/number.impl.hpp"
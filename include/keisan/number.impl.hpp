@@ -125,6 +125,34 @@ T wrap(const T & value, const T & min, const T & max)
   return min + (min_max + min_value % min_max) % min_max;
 }
 
+template<typename T>
+void wrap_all(std::vector<T> & values, const T & min, const T & max)
+{
+  // Copied, so the compiler does not have to assume the bounds alias the values.
+  T lower = min;
+  T upper = max;
+  T range = upper - lower;
+
+  size_t outside_count = 0;
+  for (const auto & value : values) {
+    outside_count += detail::is_within_period(value, lower, range) ? 0 : 1;
+  }
+
+  if (outside_count == 0) {
+    for (auto & value : values) {
+      value = detail::wrap_within_period(value, lower, range);
+    }
+  } else {
+    for (auto & value : values) {
+      if (detail::is_within_period(value, lower, range)) {
+        value = detail::wrap_within_period(value, lower, range);
+      } else {
+        value = wrap(value, lower, upper);
+      }
+    }
+  }
+}
+
 template<typename T>
 T smooth(T value, T target, T ratio)
 {
@@ -147,6 +175,73 @@ T lerp(const T & start, const T & end, const T & rate)
   return (start + ((end - start) * rate));
 }
 
+namespace detail
+{
+
+template<typename T>
+bool is_within_period(const T & value, const T & min, const T & range)
+{
+  return std::abs(value - min) < range;
+}
+
+// Equal to wrap() for values within one period of min, as the inner modulo is then a no-op and
+// the outer modulo on [0, 2 * range] reduces to a subtraction. The subtraction result is compared
+// instead of the wrapped value so the compiler is able to turn the selects into vector blends.
+template<typename T>
+T wrap_within_period(const T & value, const T & min, const T & range)
+{
+  T wrapped = range + (value - min);
+  T reduced = wrapped - range;
+  wrapped = (reduced >= 0) ? reduced : wrapped;
+
+  // range + (value - min) may round up to 2 * range, which the modulo maps to zero.
+  wrapped = (wrapped == range) ? 0 : wrapped;
+
+  return min + wrapped;
+}
+
+template<typename T>
+T lane_sum(const T * values, size_t size)
+{
+  T sums[reduction_lanes] = {0, 0, 0, 0};
+
+  size_t i = 0;
+  for (; i + reduction_lanes <= size; i += reduction_lanes) {
+    for (size_t lane = 0; lane < reduction_lanes; ++lane) {
+      sums[lane] += values[i + lane];
+    }
+  }
+
+  T sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+  for (; i < size; ++i) {
+    sum += values[i];
+  }
+
+  return sum;
+}
+
+template<typename T>
+T lane_centered_product(const T * a, T a_offset, const T * b, T b_offset, size_t size)
+{
+  T sums[reduction_lanes] = {0, 0, 0, 0};
+
+  size_t i = 0;
+  for (; i + reduction_lanes <= size; i += reduction_lanes) {
+    for (size_t lane = 0; lane < reduction_lanes; ++lane) {
+      sums[lane] += (a[i + lane] - a_offset) * (b[i + lane] - b_offset);
+    }
+  }
+
+  T sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+  for (; i < size; ++i) {
+    sum += (a[i] - a_offset) * (b[i] - b_offset);
+  }
+
+  return sum;
+}
+
+}  // namespace detail
+
 }  // namespace keisan
 
 #endif  // KEISAN__NUMBER_IMPL_HPP_
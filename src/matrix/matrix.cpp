@@ -18,10 +18,13 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <cmath>
+
 #include "keisan/matrix/matrix.hpp"
 
 #include "keisan/angle/angle.hpp"
 #include "keisan/angle/euler.hpp"
+#include "keisan/angle/quaternion.hpp"
 #include "keisan/geometry/point_2.hpp"
 #include "keisan/geometry/point_3.hpp"
 
@@ -49,34 +52,83 @@ Matrix<3, 3> translation_matrix(const Point2 & point)
 
 Matrix<4, 4> rotation_matrix(const Euler<double> & angle)
 {
-  auto roll = Matrix<4, 4>::identity();
-  roll[1][1] = angle.roll.cos();
-  roll[1][2] = -angle.roll.sin();
-  roll[2][1] = angle.roll.sin();
-  roll[2][2] = angle.roll.cos();
-
-  auto pitch = Matrix<4, 4>::identity();
-  pitch[0][0] = angle.pitch.cos();
-  pitch[0][2] = -angle.pitch.sin();
-  pitch[0][2] = angle.pitch.sin();
-  pitch[2][2] = angle.pitch.cos();
-
-  auto yaw = Matrix<4, 4>::identity();
-  yaw[0][0] = angle.yaw.cos();
-  yaw[0][1] = -angle.yaw.sin();
-  yaw[1][0] = angle.yaw.sin();
-  yaw[1][1] = angle.yaw.cos();
-
-  return (yaw * pitch) * roll;
+  auto [sr, cr] = angle.roll.sincos();
+  auto [sp, cp] = angle.pitch.sincos();
+  auto [sy, cy] = angle.yaw.sincos();
+
+  // Closed form of yaw * pitch * roll.
+  auto matrix = Matrix<4, 4>::identity();
+  matrix[0][0] = cy * cp;
+  matrix[0][1] = cy * sp * sr - sy * cr;
+  matrix[0][2] = cy * sp * cr + sy * sr;
+  matrix[1][0] = sy * cp;
+  matrix[1][1] = sy * sp * sr + cy * cr;
+  matrix[1][2] = sy * sp * cr - cy * sr;
+  matrix[2][0] = -sp;
+  matrix[2][1] = cp * sr;
+  matrix[2][2] = cp * cr;
+
+  return matrix;
+}
+
+Matrix<4, 4> rotation_matrix(const Quaternion<double> & quaternion)
+{
+  const auto & [x, y, z, w] = quaternion;
+
+  // Scaling by the squared norm keeps the result a pure rotation for non unit quaternions.
+  double s = 2.0 / quaternion.dot(quaternion);
+
+  auto matrix = Matrix<4, 4>::identity();
+  matrix[0][0] = 1.0 - s * (y * y + z * z);
+  matrix[0][1] = s * (x * y - z * w);
+  matrix[0][2] = s * (x * z + y * w);
+  matrix[1][0] = s * (x * y + z * w);
+  matrix[1][1] = 1.0 - s * (x * x + z * z);
+  matrix[1][2] = s * (y * z - x * w);
+  matrix[2][0] = s * (x * z - y * w);
+  matrix[2][1] = s * (y * z + x * w);
+  matrix[2][2] = 1.0 - s * (x * x + y * y);
+
+  return matrix;
+}
+
+Quaternion<double> rotation_quaternion(const Matrix<4, 4> & matrix)
+{
+  double trace = matrix[0][0] + matrix[1][1] + matrix[2][2];
+
+  // Shepperd method, derive from the largest diagonal term to avoid dividing by a small value.
+  if (trace >= matrix[0][0] && trace >= matrix[1][1] && trace >= matrix[2][2]) {
+    double s = 2.0 * std::sqrt(1.0 + trace);
+    return Quaternion<double>(
+      (matrix[2][1] - matrix[1][2]) / s, (matrix[0][2] - matrix[2][0]) / s,
+      (matrix[1][0] - matrix[0][1]) / s, 0.25 * s);
+  } else if (matrix[0][0] >= matrix[1][1] && matrix[0][0] >= matrix[2][2]) {
+    double s = 2.0 * std::sqrt(1.0 + matrix[0][0] - matrix[1][1] - matrix[2][2]);
+    return Quaternion<double>(
+      0.25 * s, (matrix[0][1] + matrix[1][0]) / s,
+      (matrix[0][2] + matrix[2][0]) / s, (matrix[2][1] - matrix[1][2]) / s);
+  } else if (matrix[1][1] >= matrix[2][2]) {
+    double s = 2.0 * std::sqrt(1.0 + matrix[1][1] - matrix[0][0] - matrix[2][2]);
+    return Quaternion<double>(
+      (matrix[0][1] + matrix[1][0]) / s, 0.25 * s,
+      (matrix[1][2] + matrix[2][1]) / s, (matrix[0][2] - matrix[2][0]) / s);
+  } else {
+    double s = 2.0 * std::sqrt(1.0 + matrix[2][2] - matrix[0][0] - matrix[1][1]);
+    return Quaternion<double>(
+      (matrix[0][2] + matrix[2][0]) / s, (matrix[1][2] + matrix[2][1]) / s,
+      0.25 * s, (matrix[1][0] - matrix[0][1]) / s);
+  }
 }
 
 Matrix<3, 3> rotation_matrix(const Angle<double> & angle)
 {
+  auto [sin, cos] = angle.sincos();
+
   auto matrix = Matrix<3, 3>::identity();
-  matrix[0][0] = angle.cos();
-  matrix[0][1] = -angle.sin();
-  matrix[1][0] = angle.sin();
-  matrix[1][1] = angle.cos();
+  matrix[0][0] = cos;
+  matrix[0][1] = -sin;
+  matrix[1][0] = sin;
+  matrix[1][1] = cos;
 
   return matrix;
 }
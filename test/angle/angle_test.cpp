@@ -206,3 +206,39 @@ TEST(AngleTest, Tan)
   EXPECT_DOUBLE_EQ(ksn::make_degree(45).tan(), 1.0) << "tan(45) = 1";
   EXPECT_DOUBLE_EQ((-45_deg).tan(), -1.0) << "tan(-45) = -1";
 }
+
+TEST(AngleTest, SinCos)
+{
+  auto [sin, cos] = ksn::make_degree(30).sincos();
+  EXPECT_DOUBLE_EQ(sin, 0.5) << "sin(30) = 0.5";
+  EXPECT_DOUBLE_EQ(cos, (30_deg).cos()) << "cos(30) = cos(30)";
+
+  auto angle = -0.75_pi_rad;
+  EXPECT_DOUBLE_EQ(angle.sincos().first, angle.sin());
+  EXPECT_DOUBLE_EQ(angle.sincos().second, angle.cos());
+}
+
+TEST(AngleTest, NormalizeAll)
+{
+  std::vector<ksn::Angle<double>> angles;
+  for (double value = -720.0; value <= 720.0; value += 7.5) {
+    angles.push_back(ksn::make_degree(value));
+    angles.push_back(ksn::make_radian(value / 90.0));
+  }
+
+  auto normalized = angles;
+  ksn::normalize_all(normalized);
+
+  for (size_t i = 0; i < angles.size(); ++i) {
+    EXPECT_EQ(normalized[i], angles[i].normalize()) << "at " << angles[i].degree();
+  }
+
+  std::vector<ksn::Angle<int>> int_angles = {
+    ksn::make_degree(270), ksn::make_degree(-900), ksn::make_radian(5)};
+  auto int_normalized = int_angles;
+  ksn::normalize_all(int_normalized);
+
+  for (size_t i = 0; i < int_angles.size(); ++i) {
+    EXPECT_EQ(int_normalized[i], int_angles[i].normalize());
+  }
+}
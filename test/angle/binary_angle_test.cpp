@@ -0,0 +1,96 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cstdint>
+
+#include "../comparison/angle.hpp"
+
+namespace ksn = keisan;
+
+using ksn::literals::operator""_deg;
+
+TEST(BinaryAngleTest, RawValue)
+{
+  EXPECT_EQ(ksn::BinaryAngle<uint16_t>(0x4000).value(), 0x4000);
+  EXPECT_EQ(ksn::BinaryAngle<uint32_t>(0x80000000u).value(), 0x80000000u);
+}
+
+TEST(BinaryAngleTest, FromAngle)
+{
+  EXPECT_EQ(ksn::BinaryAngle<uint16_t>(0_deg).value(), 0);
+  EXPECT_EQ(ksn::BinaryAngle<uint16_t>(90_deg).value(), 0x4000);
+  EXPECT_EQ(ksn::BinaryAngle<uint16_t>(-90_deg).value(), 0xC000);
+  EXPECT_EQ(ksn::BinaryAngle<uint16_t>(540_deg).value(), 0x8000);
+  EXPECT_EQ(ksn::BinaryAngle<uint16_t>(ksn::make_degree(360)).value(), 0);
+  EXPECT_EQ(ksn::BinaryAngle<uint32_t>(45_deg).value(), 0x20000000u);
+  EXPECT_EQ(ksn::BinaryAngle<uint64_t>(45_deg).value(), 0x2000000000000000u);
+
+  // Just below a full turn rounds up to it, which wraps to zero even for 64 bits.
+  EXPECT_EQ(ksn::BinaryAngle<uint16_t>(ksn::make_degree(-1e-4)).value(), 0);
+  EXPECT_EQ(ksn::BinaryAngle<uint64_t>(ksn::make_degree(-1e-15)).value(), 0u);
+}
+
+TEST(BinaryAngleTest, ToAngle)
+{
+  EXPECT_ANGLE_EQ(ksn::Angle<double>(ksn::BinaryAngle<uint16_t>(0x4000)), 90_deg);
+  EXPECT_ANGLE_EQ(ksn::Angle<double>(ksn::BinaryAngle<uint16_t>(0xC000)), -90_deg);
+  EXPECT_ANGLE_EQ(ksn::Angle<double>(ksn::BinaryAngle<uint16_t>(0x8000)), -180_deg);
+  EXPECT_ANGLE_EQ(ksn::Angle<double>(ksn::BinaryAngle<uint32_t>(270_deg)), -90_deg);
+}
+
+TEST(BinaryAngleTest, WrapAround)
+{
+  auto a = ksn::BinaryAngle<uint16_t>(270_deg);
+  auto b = ksn::BinaryAngle<uint16_t>(180_deg);
+
+  EXPECT_EQ(a + b, ksn::BinaryAngle<uint16_t>(90_deg));
+  EXPECT_EQ(b - a, ksn::BinaryAngle<uint16_t>(-90_deg));
+  EXPECT_EQ(-a, ksn::BinaryAngle<uint16_t>(90_deg));
+
+  a += b;
+  EXPECT_EQ(a, ksn::BinaryAngle<uint16_t>(90_deg));
+
+  a -= b;
+  EXPECT_EQ(a, ksn::BinaryAngle<uint16_t>(-90_deg));
+  EXPECT_NE(a, b);
+}
+
+TEST(BinaryAngleTest, SinCos)
+{
+  for (double degree = -360.0; degree <= 360.0; degree += 0.1) {
+    auto angle = ksn::make_degree(degree);
+    auto binary_angle = ksn::BinaryAngle<uint32_t>(angle);
+
+    EXPECT_NEAR(binary_angle.sin(), angle.sin(), 1e-6) << "at " << degree;
+    EXPECT_NEAR(binary_angle.cos(), angle.cos(), 1e-6) << "at " << degree;
+
+    auto [sin, cos] = binary_angle.sincos();
+    EXPECT_DOUBLE_EQ(sin, binary_angle.sin()) << "at " << degree;
+    EXPECT_DOUBLE_EQ(cos, binary_angle.cos()) << "at " << degree;
+  }
+
+  auto [sin_64, cos_64] = ksn::BinaryAngle<uint64_t>(120_deg).sincos();
+  EXPECT_NEAR(sin_64, (120_deg).sin(), 1e-6);
+  EXPECT_NEAR(cos_64, (120_deg).cos(), 1e-6);
+
+  auto [sin, cos] = ksn::BinaryAngle<uint16_t>(30_deg).sincos();
+  EXPECT_NEAR(sin, 0.5, 1e-4);
+  EXPECT_NEAR(cos, (30_deg).cos(), 1e-4);
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cmath>
+#include <vector>
+
+#include "../comparison/angle.hpp"
+
+namespace ksn = keisan;
+
+using ksn::literals::operator""_deg;
+
+TEST(CircularStatisticsTest, Empty)
+{
+  ksn::CircularStatistics<double> statistics;
+
+  EXPECT_EQ(statistics.count(), 0u);
+  EXPECT_DOUBLE_EQ(statistics.total_weight(), 0.0);
+  EXPECT_DOUBLE_EQ(statistics.resultant_length(), 0.0);
+}
+
+TEST(CircularStatisticsTest, MeanAcrossBoundary)
+{
+  ksn::CircularStatistics<double> statistics;
+  statistics.add(170_deg);
+  statistics.add(-170_deg);
+
+  EXPECT_EQ(statistics.count(), 2u);
+  EXPECT_NEAR(std::abs(statistics.mean().degree()), 180.0, 1e-9);
+
+  statistics.reset();
+  statistics.add(-10_deg);
+  statistics.add(30_deg);
+
+  EXPECT_NEAR(statistics.mean().degree(), 10.0, 1e-9);
+  EXPECT_NEAR(statistics.resultant_length(), (20_deg).cos(), 1e-12);
+  EXPECT_NEAR(statistics.variance(), 1.0 - (20_deg).cos(), 1e-12);
+}
+
+TEST(CircularStatisticsTest, WeightedMean)
+{
+  ksn::CircularStatistics<double> statistics;
+  statistics.add(0_deg, 3.0);
+  statistics.add(90_deg, 3.0);
+  statistics.add(-90_deg, 1.0);
+
+  EXPECT_DOUBLE_EQ(statistics.total_weight(), 7.0);
+  EXPECT_NEAR(statistics.mean().degree(), (ksn::signed_arctan(2.0, 3.0)).degree(), 1e-9);
+}
+
+TEST(CircularStatisticsTest, Dispersion)
+{
+  ksn::CircularStatistics<double> statistics;
+  for (int i = 0; i < 10; ++i) {
+    statistics.add(45_deg);
+  }
+
+  EXPECT_NEAR(statistics.resultant_length(), 1.0, 1e-12);
+  EXPECT_NEAR(statistics.variance(), 0.0, 1e-12);
+  EXPECT_NEAR(statistics.standard_deviation(), 0.0, 1e-5);
+
+  statistics.add(-135_deg, 10.0);
+  EXPECT_NEAR(statistics.resultant_length(), 0.0, 1e-12);
+  EXPECT_NEAR(statistics.variance(), 1.0, 1e-12);
+}
+
+TEST(CircularStatisticsTest, BatchAndMerge)
+{
+  std::vector<ksn::Angle<double>> angles;
+  std::vector<double> weights;
+  for (double degree = 150.0; degree <= 210.0; degree += 5.0) {
+    angles.push_back(ksn::make_degree(degree));
+    weights.push_back(degree < 180.0 ? 1.0 : 2.0);
+  }
+
+  ksn::CircularStatistics<double> single;
+  for (const auto & angle : angles) {
+    single.add(angle);
+  }
+
+  ksn::CircularStatistics<double> batch;
+  batch.add(angles);
+
+  EXPECT_EQ(batch.count(), single.count());
+  EXPECT_NEAR(batch.mean().degree(), single.mean().degree(), 1e-5);
+  EXPECT_NEAR(batch.resultant_length(), single.resultant_length(), 1e-7);
+
+  ksn::CircularStatistics<double> first;
+  ksn::CircularStatistics<double> second;
+  std::vector<ksn::Angle<double>> first_angles(angles.begin(), angles.begin() + 5);
+  std::vector<ksn::Angle<double>> second_angles(angles.begin() + 5, angles.end());
+  first.add(first_angles);
+  second.add(second_angles);
+  first.merge(second);
+
+  EXPECT_EQ(first.count(), batch.count());
+  EXPECT_NEAR(first.mean().degree(), batch.mean().degree(), 1e-9);
+
+  ksn::CircularStatistics<double> weighted;
+  weighted.add(angles, weights);
+
+  EXPECT_DOUBLE_EQ(weighted.total_weight(), 6.0 + 2.0 * 7.0);
+  EXPECT_GT(ksn::wrap(weighted.mean().degree(), 0.0, 360.0), 180.0);
+
+  ksn::CircularStatistics<double> weighted_single;
+  for (size_t i = 0; i < angles.size(); ++i) {
+    weighted_single.add(angles[i], weights[i]);
+  }
+
+  EXPECT_NEAR(weighted.mean().degree(), weighted_single.mean().degree(), 1e-5);
+  EXPECT_NEAR(weighted.resultant_length(), weighted_single.resultant_length(), 1e-7);
+
+  weights.pop_back();
+  EXPECT_THROW(weighted.add(angles, weights), std::invalid_argument);
+}
+
+TEST(CircularStatisticsTest, BatchAcrossBlocks)
+{
+  std::vector<ksn::Angle<double>> angles;
+  std::vector<double> weights;
+  for (int i = 0; i < 1000; ++i) {
+    angles.push_back(ksn::make_degree(170.0 + 0.037 * i));
+    weights.push_back(1.0 + (i % 7));
+  }
+
+  ksn::CircularStatistics<double> single;
+  for (size_t i = 0; i < angles.size(); ++i) {
+    single.add(angles[i], weights[i]);
+  }
+
+  ksn::CircularStatistics<double> batch;
+  batch.add(angles, weights);
+
+  EXPECT_EQ(batch.count(), single.count());
+  EXPECT_DOUBLE_EQ(batch.total_weight(), single.total_weight());
+  EXPECT_NEAR(batch.mean().degree(), single.mean().degree(), 1e-5);
+  EXPECT_NEAR(batch.resultant_length(), single.resultant_length(), 1e-7);
+}
@@ -98,3 +98,97 @@ TEST(EulerTest, QuaternionConversion)
 
   ASSERT_TRUE(quaternion.euler() == euler);
 }
+
+namespace
+{
+
+ksn::Quaternion<double> axis_quaternion(int axis, const ksn::Angle<double> & angle)
+{
+  auto [sin, cos] = (0.5 * angle).sincos();
+
+  return ksn::Quaternion<double>(
+    axis == 0 ? sin : 0.0, axis == 1 ? sin : 0.0, axis == 2 ? sin : 0.0, cos);
+}
+
+template<ksn::EulerOrder Order>
+void expect_euler_order(
+  int first_axis, int second_axis, int third_axis,
+  double roll, double pitch, double yaw)
+{
+  ksn::Euler<double, Order> euler(
+    ksn::make_degree(roll), ksn::make_degree(pitch), ksn::make_degree(yaw));
+
+  // Tait-Bryan angles follow their axis, proper Euler angles follow the yaw, pitch, roll order.
+  bool is_proper = first_axis == third_axis;
+  const ksn::Angle<double> * angles[] = {&euler.roll, &euler.pitch, &euler.yaw};
+  auto expected =
+    axis_quaternion(first_axis, *angles[is_proper ? 2 : first_axis]) *
+    axis_quaternion(second_axis, *angles[is_proper ? 1 : second_axis]) *
+    axis_quaternion(third_axis, *angles[is_proper ? 0 : third_axis]);
+
+  auto quaternion = euler.quaternion();
+  EXPECT_NEAR(quaternion.x, expected.x, 1e-12);
+  EXPECT_NEAR(quaternion.y, expected.y, 1e-12);
+  EXPECT_NEAR(quaternion.z, expected.z, 1e-12);
+  EXPECT_NEAR(quaternion.w, expected.w, 1e-12);
+
+  auto result = quaternion.template euler<Order>();
+  EXPECT_NEAR(result.roll.degree(), roll, 1e-9);
+  EXPECT_NEAR(result.pitch.degree(), pitch, 1e-9);
+  EXPECT_NEAR(result.yaw.degree(), yaw, 1e-9);
+}
+
+template<ksn::EulerOrder Order>
+void expect_euler_gimbal_lock(const ksn::Euler<double, Order> & euler)
+{
+  auto quaternion = euler.quaternion();
+  auto result = quaternion.template euler<Order>().quaternion();
+
+  double sign = (result.dot(quaternion) < 0.0) ? -1.0 : 1.0;
+  EXPECT_NEAR(sign * result.x, quaternion.x, 1e-6);
+  EXPECT_NEAR(sign * result.y, quaternion.y, 1e-6);
+  EXPECT_NEAR(sign * result.z, quaternion.z, 1e-6);
+  EXPECT_NEAR(sign * result.w, quaternion.w, 1e-6);
+}
+
+}  // namespace
+
+TEST(EulerTest, TaitBryanOrder)
+{
+  using ksn::EulerOrder;
+
+  expect_euler_order<EulerOrder::XYZ>(0, 1, 2, 20.0, -35.0, 110.0);
+  expect_euler_order<EulerOrder::XZY>(0, 2, 1, 20.0, -35.0, 60.0);
+  expect_euler_order<EulerOrder::YXZ>(1, 0, 2, 70.0, -35.0, 110.0);
+  expect_euler_order<EulerOrder::YZX>(1, 2, 0, -150.0, 35.0, 80.0);
+  expect_euler_order<EulerOrder::ZXY>(2, 0, 1, 20.0, -135.0, -110.0);
+  expect_euler_order<EulerOrder::ZYX>(2, 1, 0, 170.0, 5.0, -10.0);
+}
+
+TEST(EulerTest, ProperEulerOrder)
+{
+  using ksn::EulerOrder;
+
+  expect_euler_order<EulerOrder::XYX>(0, 1, 0, 20.0, 35.0, 110.0);
+  expect_euler_order<EulerOrder::XZX>(0, 2, 0, -20.0, 135.0, 60.0);
+  expect_euler_order<EulerOrder::YXY>(1, 0, 1, 70.0, 5.0, -110.0);
+  expect_euler_order<EulerOrder::YZY>(1, 2, 1, -150.0, 175.0, 80.0);
+  expect_euler_order<EulerOrder::ZXZ>(2, 0, 2, 20.0, 90.0, -170.0);
+  expect_euler_order<EulerOrder::ZYZ>(2, 1, 2, 170.0, 45.0, -10.0);
+}
+
+TEST(EulerTest, GimbalLock)
+{
+  using ksn::EulerOrder;
+
+  expect_euler_gimbal_lock(ksn::Euler<double, EulerOrder::XYZ>(30_deg, 90_deg, 40_deg));
+  expect_euler_gimbal_lock(ksn::Euler<double, EulerOrder::ZYX>(30_deg, -90_deg, 40_deg));
+  expect_euler_gimbal_lock(ksn::Euler<double, EulerOrder::YZX>(30_deg, 70_deg, 90_deg));
+  expect_euler_gimbal_lock(ksn::Euler<double, EulerOrder::ZXZ>(30_deg, 0_deg, 40_deg));
+  expect_euler_gimbal_lock(ksn::Euler<double, EulerOrder::YXY>(30_deg, 180_deg, 40_deg));
+
+  auto euler = ksn::Euler<double>(30_deg, 90_deg, 40_deg).quaternion().euler();
+  EXPECT_NEAR(euler.roll.degree(), 0.0, 1e-9);
+  EXPECT_NEAR(euler.pitch.degree(), 90.0, 1e-6);
+  EXPECT_NEAR(euler.yaw.degree(), 10.0, 1e-6);
+}
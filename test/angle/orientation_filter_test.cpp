@@ -0,0 +1,130 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+ksn::Point3 measured_gravity(const ksn::Quaternion<double> & orientation)
+{
+  return ksn::Point3(0.0, 0.0, 9.81).rotate(orientation.conjugate());
+}
+
+}  // namespace
+
+TEST(OrientationFilterTest, Initial)
+{
+  ksn::MadgwickFilter<double> madgwick;
+  ksn::MahonyFilter<double> mahony;
+
+  EXPECT_TRUE(madgwick.get_orientation() == ksn::Quaternion<double>::identity());
+  EXPECT_TRUE(mahony.get_orientation() == ksn::Quaternion<double>::identity());
+}
+
+TEST(OrientationFilterTest, GyroIntegration)
+{
+  ksn::MadgwickFilter<double> madgwick;
+  ksn::MahonyFilter<double> mahony;
+
+  auto gravity = ksn::Point3(0.0, 0.0, 9.81);
+  auto gyro = ksn::Point3(0.0, 0.0, 0.5);
+  for (int i = 0; i < 1000; ++i) {
+    madgwick.update(gyro, gravity, 0.001);
+    mahony.update(gyro, gravity, 0.001);
+  }
+
+  EXPECT_NEAR(madgwick.get_orientation().euler().yaw.radian(), 0.5, 1e-6);
+  EXPECT_NEAR(mahony.get_orientation().euler().yaw.radian(), 0.5, 1e-6);
+  EXPECT_NEAR(madgwick.get_orientation().magnitude(), 1.0, 1e-12);
+}
+
+TEST(OrientationFilterTest, GravityConvergence)
+{
+  auto expected = ksn::Euler<double>(
+    ksn::make_degree(30.0), ksn::make_degree(-20.0), ksn::make_degree(0.0)).quaternion();
+  auto acceleration = measured_gravity(expected);
+
+  ksn::MadgwickFilter<double> madgwick(0.1);
+  ksn::MahonyFilter<double> mahony(2.0);
+  for (int i = 0; i < 5000; ++i) {
+    madgwick.update(ksn::Point3::zero(), acceleration, 0.005);
+    mahony.update(ksn::Point3::zero(), acceleration, 0.005);
+  }
+
+  for (const auto & orientation : {madgwick.get_orientation(), mahony.get_orientation()}) {
+    auto euler = orientation.euler();
+    EXPECT_NEAR(euler.roll.degree(), 30.0, 0.1);
+    EXPECT_NEAR(euler.pitch.degree(), -20.0, 0.1);
+  }
+}
+
+TEST(OrientationFilterTest, GyroBiasCompensation)
+{
+  auto gravity = ksn::Point3(0.0, 0.0, 9.81);
+  auto biased_gyro = ksn::Point3(0.02, -0.01, 0.0);
+
+  ksn::MahonyFilter<double> proportional(1.0);
+  ksn::MahonyFilter<double> integral(1.0, 0.5);
+  for (int i = 0; i < 20000; ++i) {
+    proportional.update(biased_gyro, gravity, 0.005);
+    integral.update(biased_gyro, gravity, 0.005);
+  }
+
+  auto euler = integral.get_orientation().euler();
+  EXPECT_NEAR(euler.roll.degree(), 0.0, 0.01);
+  EXPECT_NEAR(euler.pitch.degree(), 0.0, 0.01);
+  EXPECT_GT(std::abs(proportional.get_orientation().euler().roll.degree()), 0.5);
+}
+
+TEST(OrientationFilterTest, BatchReplay)
+{
+  std::vector<ksn::Vector<3>> gyros;
+  std::vector<ksn::Vector<3>> accelerations;
+  for (int i = 0; i < 200; ++i) {
+    gyros.push_back(ksn::Point3(0.1 * (i % 7), -0.2, 0.05 * (i % 3)));
+    accelerations.push_back(ksn::Point3(0.5, -0.3 + 0.01 * i, 9.7));
+  }
+
+  ksn::MadgwickFilter<double> single;
+  ksn::MadgwickFilter<double> batch;
+  std::vector<ksn::Quaternion<double>> orientations;
+
+  batch.update(gyros, accelerations, 0.001, orientations);
+  ASSERT_EQ(orientations.size(), gyros.size());
+  for (size_t i = 0; i < gyros.size(); ++i) {
+    single.update(gyros[i], accelerations[i], 0.001);
+    EXPECT_TRUE(orientations[i] == single.get_orientation());
+  }
+
+  ksn::MahonyFilter<float> mahony;
+  std::vector<ksn::Quaternion<float>> float_orientations;
+  mahony.update(gyros, accelerations, 0.001f, float_orientations);
+  EXPECT_EQ(float_orientations.size(), gyros.size());
+
+  gyros.pop_back();
+  EXPECT_THROW(batch.update(gyros, accelerations, 0.001, orientations), std::invalid_argument);
+}
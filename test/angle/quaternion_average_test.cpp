@@ -0,0 +1,112 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+ksn::Quaternion<double> make_rotation(double roll, double pitch, double yaw)
+{
+  return ksn::Euler<double>(
+    ksn::make_degree(roll), ksn::make_degree(pitch), ksn::make_degree(yaw)).quaternion();
+}
+
+}  // namespace
+
+#define EXPECT_SAME_ROTATION(A, B, ERROR) \
+  { \
+    double _sign = ((A).dot(B) < 0.0) ? -1.0 : 1.0; \
+    EXPECT_NEAR(_sign * (A).x, (B).x, ERROR); \
+    EXPECT_NEAR(_sign * (A).y, (B).y, ERROR); \
+    EXPECT_NEAR(_sign * (A).z, (B).z, ERROR); \
+    EXPECT_NEAR(_sign * (A).w, (B).w, ERROR); \
+  }
+
+TEST(QuaternionAverageTest, Empty)
+{
+  ksn::QuaternionAverage average;
+
+  EXPECT_DOUBLE_EQ(average.total_weight(), 0.0);
+  EXPECT_TRUE(average.average() == ksn::Quaternion<double>::identity());
+  EXPECT_TRUE(average.fast_average() == ksn::Quaternion<double>::identity());
+}
+
+TEST(QuaternionAverageTest, AcrossWrapPoint)
+{
+  ksn::QuaternionAverage average;
+  average.add(make_rotation(0.0, 0.0, 170.0));
+  average.add(make_rotation(0.0, 0.0, -170.0));
+
+  auto expected = make_rotation(0.0, 0.0, 180.0);
+  EXPECT_SAME_ROTATION(average.average(), expected, 1e-12);
+  EXPECT_SAME_ROTATION(average.fast_average(), expected, 1e-12);
+}
+
+TEST(QuaternionAverageTest, SignInvariance)
+{
+  auto rotation = make_rotation(20.0, -30.0, 45.0);
+
+  ksn::QuaternionAverage average;
+  average.add(rotation);
+  average.add(-rotation);
+  average.add(rotation, 2.0);
+
+  EXPECT_DOUBLE_EQ(average.total_weight(), 4.0);
+  EXPECT_SAME_ROTATION(average.average(), rotation, 1e-12);
+  EXPECT_SAME_ROTATION(average.fast_average(), rotation, 1e-12);
+}
+
+TEST(QuaternionAverageTest, Weighted)
+{
+  ksn::QuaternionAverage average;
+  average.add(make_rotation(0.0, 0.0, 0.0), 3.0);
+  average.add(make_rotation(0.0, 0.0, 40.0), 1.0);
+
+  auto yaw = average.average().euler().yaw.degree();
+  EXPECT_GT(yaw, 5.0);
+  EXPECT_LT(yaw, 15.0);
+  EXPECT_NEAR(average.fast_average().euler().yaw.degree(), yaw, 0.5);
+}
+
+TEST(QuaternionAverageTest, Merge)
+{
+  ksn::QuaternionAverage all;
+  ksn::QuaternionAverage first;
+  ksn::QuaternionAverage second;
+
+  for (int i = 0; i < 10; ++i) {
+    auto rotation = make_rotation(5.0 * i, -3.0 * i, 170.0 + 2.0 * i);
+    all.add(rotation, 1.0 + i);
+    ((i % 2 == 0) ? first : second).add((i % 3 == 0) ? -rotation : rotation, 1.0 + i);
+  }
+
+  first.merge(second);
+
+  EXPECT_DOUBLE_EQ(first.total_weight(), all.total_weight());
+  EXPECT_SAME_ROTATION(first.average(), all.average(), 1e-12);
+  EXPECT_SAME_ROTATION(first.fast_average(), all.fast_average(), 1e-12);
+
+  all.reset();
+  EXPECT_DOUBLE_EQ(all.total_weight(), 0.0);
+}
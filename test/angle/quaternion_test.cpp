@@ -86,3 +86,75 @@ TEST(QuaternionTest, ComparisonOperator) {
   ASSERT_FALSE(a == b);
   ASSERT_TRUE(a != b);
 }
+
+TEST(QuaternionTest, Identity)
+{
+  auto identity = ksn::Quaternion<double>::identity();
+  ksn::Quaternion<double> quaternion(0.1, -0.2, 0.3, 0.9);
+
+  EXPECT_TRUE(identity * quaternion == quaternion);
+  EXPECT_TRUE(quaternion * identity == quaternion);
+}
+
+TEST(QuaternionTest, HamiltonProduct)
+{
+  ksn::Quaternion<double> a(1.0, 2.0, 3.0, 4.0);
+  ksn::Quaternion<double> b(5.0, 6.0, 7.0, 8.0);
+
+  auto product = a * b;
+  EXPECT_DOUBLE_EQ(product.x, 24.0);
+  EXPECT_DOUBLE_EQ(product.y, 48.0);
+  EXPECT_DOUBLE_EQ(product.z, 48.0);
+  EXPECT_DOUBLE_EQ(product.w, -6.0);
+
+  a *= b;
+  EXPECT_TRUE(a == product);
+}
+
+TEST(QuaternionTest, Composition)
+{
+  auto make_yaw = [](double degree) {
+      return ksn::Euler<double>(
+        ksn::make_degree(0.0), ksn::make_degree(0.0), ksn::make_degree(degree)).quaternion();
+    };
+
+  auto composed = make_yaw(30.0) * make_yaw(60.0);
+  auto expected = make_yaw(90.0);
+
+  EXPECT_NEAR(composed.x, expected.x, 1e-12);
+  EXPECT_NEAR(composed.y, expected.y, 1e-12);
+  EXPECT_NEAR(composed.z, expected.z, 1e-12);
+  EXPECT_NEAR(composed.w, expected.w, 1e-12);
+}
+
+TEST(QuaternionTest, MagnitudeAndNormalize)
+{
+  ksn::Quaternion<double> quaternion(1.0, 1.0, 1.0, 1.0);
+
+  EXPECT_DOUBLE_EQ(quaternion.magnitude(), 2.0);
+  EXPECT_DOUBLE_EQ(quaternion.dot(quaternion), 4.0);
+
+  auto normalized = quaternion.normalize();
+  EXPECT_DOUBLE_EQ(normalized.magnitude(), 1.0);
+  EXPECT_DOUBLE_EQ(normalized.w, 0.5);
+}
+
+TEST(QuaternionTest, ConjugateAndInverse)
+{
+  ksn::Quaternion<double> quaternion(1.0, 2.0, 3.0, 4.0);
+
+  EXPECT_TRUE(quaternion.conjugate() == ksn::Quaternion<double>(-1.0, -2.0, -3.0, 4.0));
+  EXPECT_TRUE(-quaternion == ksn::Quaternion<double>(-1.0, -2.0, -3.0, -4.0));
+
+  auto product = quaternion * quaternion.inverse();
+  EXPECT_NEAR(product.x, 0.0, 1e-12);
+  EXPECT_NEAR(product.y, 0.0, 1e-12);
+  EXPECT_NEAR(product.z, 0.0, 1e-12);
+  EXPECT_NEAR(product.w, 1.0, 1e-12);
+
+  auto unit = quaternion.normalize();
+  auto inverse = unit.inverse();
+  auto conjugate = unit.conjugate();
+  EXPECT_NEAR(inverse.x, conjugate.x, 1e-12);
+  EXPECT_NEAR(inverse.w, conjugate.w, 1e-12);
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <vector>
+
+#include "../comparison/angle.hpp"
+
+namespace ksn = keisan;
+
+using ksn::literals::operator""_deg;
+
+TEST(TrigonometryTest, FastSinCos)
+{
+  for (double degree = -1080.0; degree <= 1080.0; degree += 0.25) {
+    auto angle = ksn::make_degree(degree);
+
+    auto [high_sin, high_cos] = ksn::fast_sincos(angle);
+    EXPECT_NEAR(high_sin, angle.sin(), 1e-7) << "at " << degree;
+    EXPECT_NEAR(high_cos, angle.cos(), 1e-7) << "at " << degree;
+
+    auto [low_sin, low_cos] = ksn::fast_sincos<ksn::Precision::Low>(angle);
+    EXPECT_NEAR(low_sin, angle.sin(), 1e-4) << "at " << degree;
+    EXPECT_NEAR(low_cos, angle.cos(), 1e-4) << "at " << degree;
+  }
+}
+
+TEST(TrigonometryTest, FastSinCosTypes)
+{
+  EXPECT_NEAR(ksn::fast_sin(ksn::make_degree(30)), 0.5, 1e-7);
+  EXPECT_NEAR(ksn::fast_cos(ksn::make_degree(60.0f)), 0.5f, 1e-6f);
+  EXPECT_NEAR(ksn::fast_sin(ksn::make_radian(-0.5l)), std::sin(-0.5l), 1e-7l);
+}
+
+TEST(TrigonometryTest, BatchSinCos)
+{
+  std::vector<ksn::Angle<double>> angles = {0_deg, 90_deg, ksn::make_radian(-2.5), 1000_deg};
+  std::vector<double> sines;
+  std::vector<double> cosines;
+
+  ksn::sincos(angles, sines, cosines);
+
+  ASSERT_EQ(sines.size(), angles.size());
+  ASSERT_EQ(cosines.size(), angles.size());
+  for (size_t i = 0; i < angles.size(); ++i) {
+    EXPECT_NEAR(sines[i], angles[i].sin(), 1e-7);
+    EXPECT_NEAR(cosines[i], angles[i].cos(), 1e-7);
+  }
+}
+
+TEST(TrigonometryTest, FastArcSinArcCos)
+{
+  for (double value = -1.0; value <= 1.0; value += 1.0 / 512) {
+    EXPECT_NEAR(ksn::fast_arcsin(value).radian(), std::asin(value), 1e-7) << "at " << value;
+    EXPECT_NEAR(ksn::fast_arccos(value).radian(), std::acos(value), 1e-7) << "at " << value;
+
+    EXPECT_NEAR(
+      ksn::fast_arcsin<ksn::Precision::Low>(value).radian(), std::asin(value), 1e-4) <<
+      "at " << value;
+    EXPECT_NEAR(
+      ksn::fast_arccos<ksn::Precision::Low>(value).radian(), std::acos(value), 1e-4) <<
+      "at " << value;
+  }
+}
+
+TEST(TrigonometryTest, FastArcTan)
+{
+  for (double value = -100.0; value <= 100.0; value += 1.0 / 64) {
+    EXPECT_NEAR(ksn::fast_arctan(value).radian(), std::atan(value), 1e-7) << "at " << value;
+    EXPECT_NEAR(
+      ksn::fast_arctan<ksn::Precision::Low>(value).radian(), std::atan(value), 1e-4) <<
+      "at " << value;
+  }
+
+  EXPECT_NEAR(ksn::fast_arctan(1).degree(), 45.0, 1e-5);
+}
+
+TEST(TrigonometryTest, FastSignedArcTan)
+{
+  for (double degree = -179.75; degree < 180.0; degree += 0.25) {
+    auto angle = ksn::make_degree(degree);
+    double y = 3.0 * angle.sin();
+    double x = 3.0 * angle.cos();
+
+    EXPECT_NEAR(ksn::fast_signed_arctan(y, x).radian(), std::atan2(y, x), 1e-7) << "at " << degree;
+    EXPECT_NEAR(
+      ksn::fast_signed_arctan<ksn::Precision::Low>(y, x).radian(), std::atan2(y, x), 1e-4) <<
+      "at " << degree;
+  }
+
+  EXPECT_ANGLE_EQ(ksn::fast_signed_arctan(0, 0), 0_deg);
+  EXPECT_NEAR(ksn::fast_signed_arctan(0, -5).degree(), 180.0, 1e-5);
+  EXPECT_NEAR(ksn::fast_signed_arctan(-5, 0).degree(), -90.0, 1e-5);
+}
+
+TEST(TrigonometryTest, BatchInverse)
+{
+  std::vector<double> values = {-1.0, -0.5, 0.0, 0.25, 1.0};
+  std::vector<ksn::Angle<double>> angles;
+
+  ksn::arcsin(values, angles);
+  ASSERT_EQ(angles.size(), values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_NEAR(angles[i].radian(), std::asin(values[i]), 1e-7);
+  }
+
+  ksn::arccos(values, angles);
+  ASSERT_EQ(angles.size(), values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_NEAR(angles[i].radian(), std::acos(values[i]), 1e-7);
+  }
+
+  std::vector<double> y = {1.0, -2.0, 0.0};
+  std::vector<double> x = {1.0, -2.0, -3.0};
+
+  ksn::signed_arctan(y, x, angles);
+  ASSERT_EQ(angles.size(), y.size());
+  for (size_t i = 0; i < y.size(); ++i) {
+    EXPECT_NEAR(angles[i].radian(), std::atan2(y[i], x[i]), 1e-7);
+  }
+
+  EXPECT_THROW(ksn::signed_arctan(y, values, angles), std::invalid_argument);
+}
+
+TEST(TrigonometryTest, BatchDirection)
+{
+  std::vector<ksn::Point2> points = {{0.0, 4.0}, {-4.0, 0.0}, {3.0, -3.0}};
+  std::vector<ksn::Angle<double>> angles;
+
+  ksn::direction(points, angles);
+
+  ASSERT_EQ(angles.size(), points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(angles[i].radian(), points[i].direction().radian(), 1e-7);
+  }
+}
@@ -31,7 +31,7 @@
 namespace testing
 {
 
-std::string point2_print_string(const keisan::Point2 & point)
+inline std::string point2_print_string(const keisan::Point2 & point)
 {
   std::stringstream ss;
   ss << std::setprecision(std::numeric_limits<double>::digits10 + 2) <<
@@ -40,7 +40,7 @@ std::string point2_print_string(const keisan::Point2 & point)
   return internal::StringStreamToString(&ss);
 }
 
-AssertionResult point2_equal(
+inline AssertionResult point2_equal(
   const char * lhs_expression, const char * rhs_expression,
   const keisan::Point2 & lhs_value, const keisan::Point2 & rhs_value)
 {
@@ -31,7 +31,7 @@
 namespace testing
 {
 
-std::string point3_print_string(const keisan::Point3 & point)
+inline std::string point3_print_string(const keisan::Point3 & point)
 {
   std::stringstream ss;
   ss << std::setprecision(std::numeric_limits<double>::digits10 + 2) <<
@@ -40,7 +40,7 @@ std::string point3_print_string(const keisan::Point3 & point)
   return internal::StringStreamToString(&ss);
 }
 
-AssertionResult point3_equal(
+inline AssertionResult point3_equal(
   const char * lhs_expression, const char * rhs_expression,
   const keisan::Point3 & lhs_value, const keisan::Point3 & rhs_value)
 {
@@ -0,0 +1,249 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cmath>
+#include <vector>
+
+#include "../comparison/point_2.hpp"
+#include "../comparison/point_3.hpp"
+
+namespace ksn = keisan;
+
+TEST(BoundingBoxTest, Aabb2)
+{
+  auto box = ksn::Aabb2::from_points({{1.0, 2.0}, {-1.0, 4.0}, {3.0, 3.0}});
+  EXPECT_POINT2_EQ(box.min, ksn::Point2(-1.0, 2.0));
+  EXPECT_POINT2_EQ(box.max, ksn::Point2(3.0, 4.0));
+  EXPECT_POINT2_EQ(box.center(), ksn::Point2(1.0, 3.0));
+  EXPECT_POINT2_EQ(box.half_extents(), ksn::Point2(2.0, 1.0));
+  EXPECT_DOUBLE_EQ(box.area(), 8.0);
+
+  EXPECT_TRUE(box.contains(ksn::Point2(3.0, 2.0)));
+  EXPECT_FALSE(box.contains(ksn::Point2(3.5, 2.0)));
+  EXPECT_TRUE(box.contains(ksn::Aabb2({0.0, 2.5}, {1.0, 3.5})));
+  EXPECT_FALSE(box.contains(ksn::Aabb2({0.0, 2.5}, {1.0, 4.5})));
+
+  auto empty = ksn::Aabb2::empty();
+  EXPECT_TRUE(empty.is_empty());
+  EXPECT_DOUBLE_EQ(empty.area(), 0.0);
+  EXPECT_FALSE(empty.contains(ksn::Point2(0.0, 0.0)));
+
+  auto merged = empty.merge(box).merge(ksn::Point2(5.0, 0.0));
+  EXPECT_POINT2_EQ(merged.min, ksn::Point2(-1.0, 0.0));
+  EXPECT_POINT2_EQ(merged.max, ksn::Point2(5.0, 4.0));
+
+  auto expanded = box.expand(0.5);
+  EXPECT_POINT2_EQ(expanded.min, ksn::Point2(-1.5, 1.5));
+
+  ksn::PointCloud2 cloud({{1.0, 2.0}, {-1.0, 4.0}, {3.0, 3.0}});
+  auto cloud_box = ksn::Aabb2::from_points(cloud);
+  EXPECT_POINT2_EQ(cloud_box.min, box.min);
+  EXPECT_POINT2_EQ(cloud_box.max, box.max);
+
+  EXPECT_TRUE(ksn::overlap(box, ksn::Aabb2({3.0, 4.0}, {5.0, 5.0})));
+  EXPECT_FALSE(ksn::overlap(box, ksn::Aabb2({3.1, 0.0}, {5.0, 5.0})));
+}
+
+TEST(BoundingBoxTest, Aabb3)
+{
+  auto box = ksn::Aabb3::from_points({{1.0, 2.0, 0.0}, {-1.0, 4.0, 2.0}});
+  EXPECT_POINT3_EQ(box.center(), ksn::Point3(0.0, 3.0, 1.0));
+  EXPECT_DOUBLE_EQ(box.volume(), 8.0);
+
+  EXPECT_TRUE(box.contains(ksn::Point3(0.0, 3.0, 2.0)));
+  EXPECT_FALSE(box.contains(ksn::Point3(0.0, 3.0, 2.5)));
+
+  auto merged = ksn::Aabb3::empty().merge(box).merge(ksn::Point3(0.0, 0.0, 5.0));
+  EXPECT_POINT3_EQ(merged.min, ksn::Point3(-1.0, 0.0, 0.0));
+  EXPECT_POINT3_EQ(merged.max, ksn::Point3(1.0, 4.0, 5.0));
+  EXPECT_TRUE(merged.contains(box));
+
+  EXPECT_TRUE(ksn::overlap(box, ksn::Aabb3({0.0, 0.0, 1.0}, {3.0, 3.0, 3.0})));
+  EXPECT_FALSE(ksn::overlap(box, ksn::Aabb3({0.0, 0.0, 2.5}, {3.0, 3.0, 3.0})));
+}
+
+TEST(BoundingBoxTest, Obb2)
+{
+  ksn::Obb2 square({0.0, 0.0}, {1.0, 1.0}, ksn::make_degree(0.0));
+
+  // The diamond reaches sqrt(2) from its center along the x axis.
+  EXPECT_TRUE(ksn::overlap(square, ksn::Obb2({2.3, 0.0}, {1.0, 1.0}, ksn::make_degree(45.0))));
+  EXPECT_FALSE(ksn::overlap(square, ksn::Obb2({2.5, 0.0}, {1.0, 1.0}, ksn::make_degree(45.0))));
+
+  // Only the diagonal axis of the diamond separates them, their bounds do overlap.
+  ksn::Obb2 diamond({1.9, 1.9}, {1.0, 1.0}, ksn::make_degree(45.0));
+  EXPECT_FALSE(ksn::overlap(square, diamond));
+  EXPECT_TRUE(ksn::overlap(square.bounds(), diamond.bounds()));
+  EXPECT_FALSE(ksn::overlap(diamond, ksn::Aabb2({-1.0, -1.0}, {1.0, 1.0})));
+
+  auto bounds = diamond.bounds();
+  EXPECT_DOUBLE_EQ(bounds.half_extents().x, std::sqrt(2.0));
+
+  EXPECT_TRUE(diamond.contains({1.9 + 1.3, 1.9}));
+  EXPECT_FALSE(diamond.contains({1.9 + 1.0, 1.9 + 1.0}));
+}
+
+TEST(BoundingBoxTest, Obb3)
+{
+  auto yaw = ksn::Euler<double>(
+    ksn::make_degree(0.0), ksn::make_degree(0.0), ksn::make_degree(45.0)).quaternion();
+
+  ksn::Obb3 cube({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}, ksn::Quaternion<double>::identity());
+  EXPECT_TRUE(ksn::overlap(cube, ksn::Obb3({2.3, 0.0, 0.0}, {1.0, 1.0, 1.0}, yaw)));
+  EXPECT_FALSE(ksn::overlap(cube, ksn::Obb3({2.5, 0.0, 0.0}, {1.0, 1.0, 1.0}, yaw)));
+  EXPECT_FALSE(ksn::overlap(cube, ksn::Obb3({0.0, 0.0, 2.1}, {1.0, 1.0, 1.0}, yaw)));
+
+  ksn::Obb3 tilted({1.9, 1.9, 0.0}, {1.0, 1.0, 1.0}, yaw);
+  EXPECT_FALSE(ksn::overlap(cube, tilted));
+  EXPECT_TRUE(ksn::overlap(cube.bounds(), tilted.bounds()));
+  EXPECT_FALSE(ksn::overlap(tilted, ksn::Aabb3({-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0})));
+
+  EXPECT_TRUE(tilted.contains({1.9 + 1.3, 1.9, 0.5}));
+  EXPECT_FALSE(tilted.contains({1.9 + 1.3, 1.9, 1.5}));
+
+  // Boxes sharing a center overlap whatever their orientation.
+  auto roll = ksn::Euler<double>(
+    ksn::make_degree(45.0), ksn::make_degree(0.0), ksn::make_degree(45.0)).quaternion();
+  ksn::Obb3 plate({0.0, 0.0, 0.0}, {3.0, 0.1, 0.1}, roll);
+  EXPECT_TRUE(ksn::overlap(cube, plate));
+}
+
+TEST(BoundingBoxTest, BatchOneToMany)
+{
+  std::vector<ksn::Aabb2> aabbs2;
+  std::vector<ksn::Aabb3> aabbs3;
+  std::vector<ksn::Obb2> obbs2;
+  std::vector<ksn::Obb3> obbs3;
+  for (int i = 0; i < 29; ++i) {
+    double x = -3.0 + i * 0.25;
+    double y = (i % 5) * 0.5 - 1.0;
+    auto angle = ksn::make_degree(i * 13.0);
+
+    aabbs2.push_back({{x, y}, {x + 0.4, y + 0.3}});
+    aabbs3.push_back({{x, y, -y}, {x + 0.4, y + 0.3, -y + 0.2}});
+    obbs2.push_back({{x, y}, {0.4, 0.1}, angle});
+    obbs3.push_back(
+      {{x, y, 0.5 * y}, {0.4, 0.1, 0.2},
+        ksn::Euler<double>(angle, angle * 0.5, angle * 2.0).quaternion()});
+  }
+
+  ksn::Aabb2 aabb2({-0.5, -0.5}, {0.5, 0.5});
+  ksn::Aabb3 aabb3({-0.5, -0.5, -0.5}, {0.5, 0.5, 0.5});
+  ksn::Obb2 obb2({0.0, 0.0}, {0.6, 0.3}, ksn::make_degree(30.0));
+  ksn::Obb3 obb3(
+    {0.0, 0.0, 0.0}, {0.6, 0.3, 0.4},
+    ksn::Euler<double>(
+      ksn::make_degree(10.0), ksn::make_degree(20.0), ksn::make_degree(30.0)).quaternion());
+
+  auto expect_matches = [](const std::vector<size_t> & indices, auto && test, size_t size) {
+      std::vector<size_t> expected;
+      for (size_t i = 0; i < size; ++i) {
+        if (test(i)) {
+          expected.push_back(i);
+        }
+      }
+
+      EXPECT_FALSE(expected.empty());
+      EXPECT_LT(expected.size(), size);
+      EXPECT_EQ(indices, expected);
+    };
+
+  ksn::Aabb2Array aabb2_array(aabbs2);
+  ksn::Aabb3Array aabb3_array(aabbs3);
+  ksn::Obb2Array obb2_array(obbs2);
+  ksn::Obb3Array obb3_array(obbs3);
+
+  std::vector<size_t> indices;
+  ksn::overlap(aabb2, aabb2_array, indices);
+  expect_matches(indices, [&](size_t i) {return ksn::overlap(aabb2, aabbs2[i]);}, aabbs2.size());
+
+  ksn::overlap(aabb3, aabb3_array, indices);
+  expect_matches(indices, [&](size_t i) {return ksn::overlap(aabb3, aabbs3[i]);}, aabbs3.size());
+
+  ksn::overlap(obb2, obb2_array, indices);
+  expect_matches(indices, [&](size_t i) {return ksn::overlap(obb2, obbs2[i]);}, obbs2.size());
+
+  ksn::overlap(obb3, obb3_array, indices);
+  expect_matches(indices, [&](size_t i) {return ksn::overlap(obb3, obbs3[i]);}, obbs3.size());
+}
+
+TEST(BoundingBoxTest, BoxArrayRoundTrip)
+{
+  ksn::Obb3 obb(
+    ksn::Point3(1.0, -2.0, 3.0), ksn::Point3(0.5, 1.5, 2.5),
+    ksn::Quaternion<double>(0.5, 0.5, 0.5, 0.5));
+
+  ksn::Obb3Array boxes;
+  EXPECT_TRUE(boxes.empty());
+
+  boxes.push_back(ksn::Obb3(ksn::Aabb3(ksn::Point3(0.0, 0.0, 0.0), ksn::Point3(1.0, 1.0, 1.0))));
+  boxes.push_back(obb);
+  ASSERT_EQ(boxes.size(), 2u);
+
+  ksn::Obb3 result = boxes[1];
+  EXPECT_POINT3_EQ(result.center, obb.center);
+  EXPECT_POINT3_EQ(result.half_extents, obb.half_extents);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_POINT3_EQ(result.axes[i], obb.axes[i]);
+  }
+
+  EXPECT_DOUBLE_EQ(boxes.column(0)[1], 1.0);
+  EXPECT_DOUBLE_EQ(boxes.column(5)[1], 2.5);
+
+  boxes.clear();
+  EXPECT_TRUE(boxes.empty());
+}
+
+TEST(BoundingBoxTest, ContainsCloud)
+{
+  std::vector<ksn::Point3> points;
+  for (int i = 0; i < 21; ++i) {
+    points.push_back({i * 0.1, (i % 3) * 0.5, (i % 4) * 0.5});
+  }
+
+  std::vector<ksn::Point2> flat_points;
+  for (const auto & point : points) {
+    flat_points.push_back({point.x, point.y});
+  }
+
+  ksn::Aabb2 flat_box({0.4, 0.2}, {1.6, 1.2});
+  ksn::Aabb3 box({0.4, 0.2, 0.2}, {1.6, 1.2, 1.2});
+
+  std::vector<size_t> flat_indices;
+  std::vector<size_t> indices;
+  ksn::contains(flat_box, ksn::PointCloud2(flat_points), flat_indices);
+  ksn::contains(box, ksn::PointCloud3(points), indices);
+
+  std::vector<size_t> flat_expected;
+  std::vector<size_t> expected;
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (flat_box.contains(flat_points[i])) {
+      flat_expected.push_back(i);
+    }
+
+    if (box.contains(points[i])) {
+      expected.push_back(i);
+    }
+  }
+
+  EXPECT_EQ(flat_indices, flat_expected);
+  EXPECT_EQ(indices, expected);
+  EXPECT_LT(expected.size(), flat_expected.size());
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+std::vector<ksn::Segment2> field_lines()
+{
+  return {
+    {{0.5, 0.5}, {5.5, 0.5}},
+    {{5.5, 0.5}, {5.5, 3.5}},
+    {{0.5, 3.5}, {5.5, 3.5}},
+    {{0.5, 0.5}, {0.5, 3.5}},
+    {{3.0, 0.5}, {3.0, 3.5}},
+    {{2.0, 1.5}, {4.0, 2.5}}};
+}
+
+double brute_force_distance(const std::vector<ksn::Segment2> & segments, const ksn::Point2 & point)
+{
+  double result = std::numeric_limits<double>::infinity();
+  for (const auto & segment : segments) {
+    result = std::min(result, ksn::squared_distance(segment, point));
+  }
+
+  return std::sqrt(result);
+}
+
+}  // namespace
+
+TEST(DistanceField2Test, InvalidArgument)
+{
+  EXPECT_THROW(ksn::DistanceField2<>({0.0, 0.0}, 0.0, 10, 10, 1.0), std::invalid_argument);
+  EXPECT_THROW(ksn::DistanceField2<>({0.0, 0.0}, 0.1, 0, 10, 1.0), std::invalid_argument);
+  EXPECT_THROW(ksn::DistanceField2<>({0.0, 0.0}, 0.1, 10, 10, 0.0), std::invalid_argument);
+}
+
+TEST(DistanceField2Test, Distance)
+{
+  auto segments = field_lines();
+
+  ksn::DistanceField2<double> field({0.0, 0.0}, 0.05, 120, 80, 10.0);
+  field.build(segments);
+
+  EXPECT_EQ(field.width(), 120u);
+  EXPECT_EQ(field.height(), 80u);
+  EXPECT_NEAR(field.distance({1.5, 1.5}), 0.5, 0.05);
+  EXPECT_NEAR(field.distance({3.0, 2.0}), 0.0, 0.05);
+
+  // Within half a cell diagonal of the exact distance, from interpolating between the centers.
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> x_distribution(0.0, 6.0);
+  std::uniform_real_distribution<double> y_distribution(0.0, 4.0);
+  for (int i = 0; i < 500; ++i) {
+    ksn::Point2 point(x_distribution(generator), y_distribution(generator));
+    EXPECT_NEAR(field.distance(point), brute_force_distance(segments, point), 0.036);
+  }
+
+  // Outside the grid reads the border.
+  EXPECT_DOUBLE_EQ(field.distance({-10.0, 2.0}), field.distance({0.0, 2.0}));
+}
+
+TEST(DistanceField2Test, CellCentersAgainstBruteForce)
+{
+  // Diagonal segments at odd angles, where the seeds lie off the closest points.
+  std::vector<ksn::Segment2> segments = {
+    {{0.3, 0.2}, {5.7, 3.1}},
+    {{1.1, 3.8}, {4.3, 0.4}},
+    {{0.2, 2.2}, {0.9, 2.3}},
+    {{3.7, 3.3}, {3.7, 3.3}}};
+
+  const double resolution = 0.05;
+  ksn::DistanceField2<double> field({0.0, 0.0}, resolution, 120, 80, 10.0);
+  field.build(segments);
+
+  for (size_t y = 0; y < field.height(); ++y) {
+    for (size_t x = 0; x < field.width(); ++x) {
+      ksn::Point2 center((x + 0.5) * resolution, (y + 0.5) * resolution);
+      EXPECT_NEAR(field.value(x, y), brute_force_distance(segments, center), 1e-9) <<
+        "at " << x << ", " << y;
+    }
+  }
+}
+
+TEST(DistanceField2Test, MaxDistance)
+{
+  ksn::DistanceField2<float> field({0.0, 0.0}, 0.1, 50, 50, 1.0);
+  field.build({{{0.0, 0.0}, {0.0, 5.0}}});
+
+  EXPECT_NEAR(field.distance({0.5, 2.5}), 0.5, 0.1);
+  EXPECT_DOUBLE_EQ(field.distance({4.0, 2.5}), 1.0);
+
+  field.build({});
+  EXPECT_DOUBLE_EQ(field.value(10, 10), 1.0);
+}
+
+TEST(DistanceField2Test, Quantized)
+{
+  auto segments = field_lines();
+
+  ksn::DistanceField2<double> exact({0.0, 0.0}, 0.05, 120, 80, 2.0);
+  exact.build(segments);
+
+  ksn::DistanceField2<uint8_t> compact({0.0, 0.0}, 0.05, 120, 80, 2.0);
+  compact.build(segments);
+
+  ksn::DistanceField2<uint16_t> fine({0.0, 0.0}, 0.05, 120, 80, 2.0);
+  fine.build(segments);
+
+  for (size_t y = 0; y < exact.height(); y += 7) {
+    for (size_t x = 0; x < exact.width(); x += 7) {
+      EXPECT_NEAR(compact.value(x, y), exact.value(x, y), 2.0 / 255);
+      EXPECT_NEAR(fine.value(x, y), exact.value(x, y), 2.0 / 65535);
+    }
+  }
+}
+
+TEST(DistanceField2Test, BatchDistance)
+{
+  ksn::DistanceField2<uint8_t> field({0.0, 0.0}, 0.05, 120, 80, 2.0);
+  field.build(field_lines());
+
+  std::vector<ksn::Point2> points = {{1.0, 1.0}, {2.5, 3.0}, {-1.0, 5.0}, {5.9, 0.1}};
+
+  std::vector<double> results;
+  field.distances(points, results);
+
+  std::vector<double> cloud_results;
+  field.distances(ksn::PointCloud2(points), cloud_results);
+
+  ASSERT_EQ(results.size(), points.size());
+  ASSERT_EQ(cloud_results.size(), points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_DOUBLE_EQ(results[i], field.distance(points[i]));
+    EXPECT_DOUBLE_EQ(cloud_results[i], field.distance(points[i]));
+  }
+}
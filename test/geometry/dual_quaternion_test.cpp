@@ -0,0 +1,164 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+ksn::DualQuaternion<double> make_transform(
+  double roll, double pitch, double yaw, const ksn::Point3 & translation)
+{
+  auto rotation = ksn::Euler<double>(
+    ksn::make_degree(roll), ksn::make_degree(pitch), ksn::make_degree(yaw)).quaternion();
+
+  return ksn::DualQuaternion<double>(rotation, translation);
+}
+
+}  // namespace
+
+#define EXPECT_POINT3_NEAR(A, B, ERROR) \
+  { \
+    EXPECT_NEAR((A).x, (B).x, ERROR); \
+    EXPECT_NEAR((A).y, (B).y, ERROR); \
+    EXPECT_NEAR((A).z, (B).z, ERROR); \
+  }
+
+TEST(DualQuaternionTest, Identity)
+{
+  auto identity = ksn::DualQuaternion<double>::identity();
+  auto point = ksn::Point3(1.0, -2.0, 3.0);
+
+  EXPECT_POINT3_NEAR(identity.transform(point), point, 1e-15);
+  EXPECT_POINT3_NEAR(identity.translation(), ksn::Point3::zero(), 1e-15);
+}
+
+TEST(DualQuaternionTest, RotationAndTranslation)
+{
+  auto transform = make_transform(0.0, 0.0, 90.0, ksn::Point3(1.0, 2.0, 3.0));
+
+  EXPECT_POINT3_NEAR(transform.translation(), ksn::Point3(1.0, 2.0, 3.0), 1e-12);
+  EXPECT_POINT3_NEAR(
+    transform.transform(ksn::Point3(1.0, 0.0, 0.0)), ksn::Point3(1.0, 3.0, 3.0), 1e-12);
+}
+
+TEST(DualQuaternionTest, CompositionMatchesMatrix)
+{
+  auto a = make_transform(10.0, -20.0, 30.0, ksn::Point3(1.0, 0.5, -2.0));
+  auto b = make_transform(-45.0, 15.0, 120.0, ksn::Point3(-0.3, 2.0, 1.0));
+  auto point = ksn::Point3(0.7, -1.2, 2.5);
+
+  auto composed = a * b;
+  auto matrix = a.matrix() * b.matrix();
+
+  EXPECT_POINT3_NEAR(composed.transform(point), a.transform(b.transform(point)), 1e-12);
+  EXPECT_POINT3_NEAR(
+    composed.transform(point), ksn::Point3(matrix * static_cast<ksn::Vector<4>>(point)), 1e-12);
+
+  auto c = a;
+  c *= b;
+  EXPECT_TRUE(c == composed);
+}
+
+TEST(DualQuaternionTest, Inverse)
+{
+  auto transform = make_transform(25.0, 35.0, -75.0, ksn::Point3(3.0, -1.0, 0.5));
+  auto point = ksn::Point3(1.0, 2.0, 3.0);
+
+  EXPECT_POINT3_NEAR(transform.inverse().transform(transform.transform(point)), point, 1e-12);
+  EXPECT_POINT3_NEAR(transform.conjugate().transform(transform.transform(point)), point, 1e-12);
+
+  auto product = transform * transform.inverse();
+  EXPECT_NEAR(product.real.w, 1.0, 1e-12);
+  EXPECT_POINT3_NEAR(product.translation(), ksn::Point3::zero(), 1e-12);
+}
+
+TEST(DualQuaternionTest, Normalize)
+{
+  auto transform = make_transform(25.0, 35.0, -75.0, ksn::Point3(3.0, -1.0, 0.5));
+  auto scaled = ksn::DualQuaternion<double>(
+    ksn::Quaternion<double>(
+      transform.real.x * 2.0, transform.real.y * 2.0, transform.real.z * 2.0,
+      transform.real.w * 2.0),
+    ksn::Quaternion<double>(
+      transform.dual.x * 2.0, transform.dual.y * 2.0, transform.dual.z * 2.0,
+      transform.dual.w * 2.0));
+
+  auto normalized = scaled.normalize();
+  EXPECT_NEAR(normalized.real.magnitude(), 1.0, 1e-12);
+  EXPECT_NEAR(normalized.real.dot(normalized.dual), 0.0, 1e-12);
+  EXPECT_POINT3_NEAR(normalized.translation(), transform.translation(), 1e-12);
+}
+
+TEST(DualQuaternionTest, MatrixConversion)
+{
+  auto transform = make_transform(-60.0, 10.0, 170.0, ksn::Point3(0.5, 1.5, -2.5));
+  auto matrix = transform.matrix();
+
+  auto euler = ksn::Euler<double>(
+    ksn::make_degree(-60.0), ksn::make_degree(10.0), ksn::make_degree(170.0));
+  auto expected = ksn::translation_matrix(ksn::Point3(0.5, 1.5, -2.5)) *
+    ksn::rotation_matrix(euler);
+
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      EXPECT_NEAR(matrix[i][j], expected[i][j], 1e-12);
+    }
+  }
+
+  auto converted = ksn::DualQuaternion<double>(matrix);
+  auto point = ksn::Point3(1.0, 2.0, 3.0);
+  EXPECT_POINT3_NEAR(converted.transform(point), transform.transform(point), 1e-12);
+}
+
+TEST(DualQuaternionTest, ScrewInterpolation)
+{
+  auto from = make_transform(0.0, 0.0, 0.0, ksn::Point3(0.0, 0.0, 0.0));
+  auto to = make_transform(0.0, 0.0, 90.0, ksn::Point3(0.0, 0.0, 2.0));
+
+  auto middle = ksn::sclerp(from, to, 0.5);
+  EXPECT_NEAR(middle.rotation().euler().yaw.degree(), 45.0, 1e-9);
+  EXPECT_POINT3_NEAR(middle.translation(), ksn::Point3(0.0, 0.0, 1.0), 1e-12);
+
+  auto start = make_transform(10.0, 20.0, 30.0, ksn::Point3(1.0, 2.0, 3.0));
+  auto end = make_transform(-40.0, 5.0, 100.0, ksn::Point3(-2.0, 0.0, 1.0));
+  auto point = ksn::Point3(0.3, 0.2, 0.1);
+
+  EXPECT_POINT3_NEAR(ksn::sclerp(start, end, 0.0).transform(point), start.transform(point), 1e-12);
+  EXPECT_POINT3_NEAR(ksn::sclerp(start, end, 1.0).transform(point), end.transform(point), 1e-12);
+
+  auto shifted = make_transform(10.0, 20.0, 30.0, ksn::Point3(3.0, 2.0, 3.0));
+  EXPECT_POINT3_NEAR(
+    ksn::sclerp(start, shifted, 0.25).translation(), ksn::Point3(1.5, 2.0, 3.0), 1e-12);
+
+  std::vector<double> ts = {0.0, 0.2, 0.4, 0.6, 0.8, 1.0};
+  std::vector<ksn::DualQuaternion<double>> results;
+  ksn::sclerp(start, end, ts, results);
+
+  ASSERT_EQ(results.size(), ts.size());
+  for (size_t i = 0; i < ts.size(); ++i) {
+    EXPECT_TRUE(results[i] == ksn::sclerp(start, end, ts[i]));
+  }
+}
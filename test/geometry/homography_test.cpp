@@ -0,0 +1,159 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+ksn::Matrix<3, 3> make_homography()
+{
+  return ksn::Matrix<3, 3>(
+    1.2, 0.1, -30.0,
+    -0.05, 0.9, 12.0,
+    0.0004, -0.0008, 1.0);
+}
+
+}  // namespace
+
+TEST(HomographyTest, Apply)
+{
+  auto homography = ksn::Matrix<3, 3>(
+    2.0, 0.0, 1.0,
+    0.0, 3.0, -1.0,
+    0.0, 0.0, 1.0);
+
+  auto point = ksn::apply_homography(homography, {1.0, 2.0});
+  EXPECT_DOUBLE_EQ(point.x, 3.0);
+  EXPECT_DOUBLE_EQ(point.y, 5.0);
+
+  homography[2][2] = 2.0;
+  point = ksn::apply_homography(homography, {1.0, 2.0});
+  EXPECT_DOUBLE_EQ(point.x, 1.5);
+  EXPECT_DOUBLE_EQ(point.y, 2.5);
+}
+
+TEST(HomographyTest, Find)
+{
+  auto expected = make_homography();
+
+  std::vector<ksn::Point2> sources;
+  for (double x = 0.0; x <= 640.0; x += 160.0) {
+    for (double y = 0.0; y <= 480.0; y += 120.0) {
+      sources.push_back({x, y});
+    }
+  }
+
+  std::vector<ksn::Point2> targets;
+  ksn::apply_homography(expected, sources, targets);
+
+  ksn::Matrix<3, 3> homography;
+  ASSERT_TRUE(ksn::find_homography(sources, targets, homography));
+
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      EXPECT_NEAR(homography[i][j], expected[i][j], 1e-6 * (1.0 + std::abs(expected[i][j])));
+    }
+  }
+
+  // The minimal case of four points is exact as well.
+  std::vector<ksn::Point2> corners = {{0.0, 0.0}, {640.0, 0.0}, {640.0, 480.0}, {0.0, 480.0}};
+  ksn::apply_homography(expected, corners, targets);
+  ASSERT_TRUE(ksn::find_homography(corners, targets, homography));
+
+  auto point = ksn::apply_homography(homography, {320.0, 240.0});
+  auto expected_point = ksn::apply_homography(expected, {320.0, 240.0});
+  EXPECT_NEAR(point.x, expected_point.x, 1e-6);
+  EXPECT_NEAR(point.y, expected_point.y, 1e-6);
+}
+
+TEST(HomographyTest, FindInvalid)
+{
+  std::vector<ksn::Point2> three = {{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}};
+  std::vector<ksn::Point2> four = {{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}};
+
+  ksn::Matrix<3, 3> homography;
+  EXPECT_THROW(ksn::find_homography(three, three, homography), std::invalid_argument);
+  EXPECT_THROW(ksn::find_homography(three, four, homography), std::invalid_argument);
+
+  // Collinear points leave the map underdetermined.
+  std::vector<ksn::Point2> line = {{0.0, 0.0}, {1.0, 1.0}, {2.0, 2.0}, {3.0, 3.0}};
+  EXPECT_FALSE(ksn::find_homography(line, line, homography));
+}
+
+TEST(HomographyTest, Inverse)
+{
+  auto homography = make_homography();
+  auto inverse = homography;
+  ASSERT_TRUE(inverse.inverse3());
+
+  auto identity = homography * inverse;
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      EXPECT_NEAR(identity[i][j], i == j ? 1.0 : 0.0, 1e-12);
+    }
+  }
+
+  auto point = ksn::apply_homography(inverse, ksn::apply_homography(homography, {100.0, 50.0}));
+  EXPECT_NEAR(point.x, 100.0, 1e-9);
+  EXPECT_NEAR(point.y, 50.0, 1e-9);
+
+  auto singular = ksn::Matrix<3, 3>(
+    1.0, 2.0, 3.0,
+    2.0, 4.0, 6.0,
+    0.0, 1.0, 1.0);
+  EXPECT_FALSE(singular.inverse3());
+}
+
+TEST(HomographyTest, Batch)
+{
+  auto homography = make_homography();
+
+  std::vector<ksn::Point2> points;
+  for (int i = 0; i < 37; ++i) {
+    points.push_back({i * 17.0, 480.0 - i * 11.0});
+  }
+
+  std::vector<ksn::Point2> results;
+  ksn::apply_homography(homography, points, results);
+
+  ksn::PointCloud2 cloud(points);
+  ksn::PointCloud2 cloud_results;
+  ksn::apply_homography(homography, cloud, cloud_results);
+  ksn::apply_homography(homography, cloud, cloud);
+
+  ASSERT_EQ(results.size(), points.size());
+  ASSERT_EQ(cloud_results.size(), points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    auto expected = ksn::apply_homography(homography, points[i]);
+    EXPECT_DOUBLE_EQ(results[i].x, expected.x);
+    EXPECT_DOUBLE_EQ(results[i].y, expected.y);
+    EXPECT_DOUBLE_EQ(cloud_results[i].x, expected.x);
+    EXPECT_DOUBLE_EQ(cloud_results[i].y, expected.y);
+    EXPECT_DOUBLE_EQ(cloud[i].x, expected.x);
+    EXPECT_DOUBLE_EQ(cloud[i].y, expected.y);
+  }
+}
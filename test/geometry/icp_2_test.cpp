@@ -0,0 +1,154 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+// Outline of a 4 by 3 rectangle with a diagonal inside, so no direction is ambiguous.
+std::vector<ksn::Point2> field_model(double spacing)
+{
+  int width = std::lround(4.0 / spacing);
+  int height = std::lround(3.0 / spacing);
+  int diagonal = std::lround(2.0 / spacing);
+
+  std::vector<ksn::Point2> points;
+  for (int i = 0; i <= width; ++i) {
+    points.push_back({i * spacing, 0.0});
+    points.push_back({i * spacing, 3.0});
+  }
+
+  for (int i = 1; i < height; ++i) {
+    points.push_back({0.0, i * spacing});
+    points.push_back({4.0, i * spacing});
+  }
+
+  for (int i = 1; i < diagonal; ++i) {
+    points.push_back({i * spacing, i * spacing * 0.75});
+  }
+
+  return points;
+}
+
+// The model points seen from the pose, in the pose frame.
+std::vector<ksn::Point2> observe(const std::vector<ksn::Point2> & model, const ksn::Pose2 & pose)
+{
+  std::vector<ksn::Point2> points;
+  for (const auto & point : model) {
+    points.push_back(pose.inverse_transform(point));
+  }
+
+  return points;
+}
+
+}  // namespace
+
+TEST(Icp2Test, PointToPoint)
+{
+  ksn::Pose2 truth({0.1, -0.05}, ksn::make_degree(3.0));
+
+  ksn::Icp2 icp;
+  icp.set_target(field_model(0.01));
+  icp.set_max_iterations(100);
+
+  // Point to point stops once the closest points no longer change, so it is only as accurate
+  // as the spacing of the target allows.
+  ksn::Pose2 pose;
+  EXPECT_TRUE(icp.align(observe(field_model(0.1), truth), pose));
+
+  EXPECT_NEAR(pose.get_position().x, 0.1, 0.02);
+  EXPECT_NEAR(pose.get_position().y, -0.05, 0.02);
+  EXPECT_NEAR(pose.get_orientation().degree(), 3.0, 0.5);
+  EXPECT_LT(icp.get_mean_squared_error(), 1e-4);
+
+  EXPECT_EQ(icp.get_iteration_times().size(), icp.get_iterations());
+}
+
+TEST(Icp2Test, PointToLine)
+{
+  ksn::Pose2 truth({-0.15, 0.1}, ksn::make_degree(-4.0));
+
+  ksn::Icp2 icp(ksn::IcpMethod::PointToLine);
+  icp.set_target(field_model(0.05));
+  icp.set_max_correspondence_distance(0.5);
+
+  ksn::Pose2 pose;
+  EXPECT_TRUE(icp.align(observe(field_model(0.15), truth), pose));
+
+  EXPECT_NEAR(pose.get_position().x, -0.15, 5e-3);
+  EXPECT_NEAR(pose.get_position().y, 0.1, 5e-3);
+  EXPECT_NEAR(pose.get_orientation().degree(), -4.0, 0.1);
+  EXPECT_LT(icp.get_iterations(), 30u);
+}
+
+TEST(Icp2Test, GivenNormals)
+{
+  std::vector<ksn::Point2> points;
+  std::vector<ksn::Point2> normals;
+  for (int i = 0; i <= 40; ++i) {
+    points.push_back({i * 0.1, 0.0});
+    normals.push_back({0.0, 1.0});
+    points.push_back({0.0, i * 0.1});
+    normals.push_back({1.0, 0.0});
+  }
+
+  ksn::Icp2 icp(ksn::IcpMethod::PointToLine);
+  EXPECT_THROW(icp.set_target(points, {}), std::invalid_argument);
+  icp.set_target(points, normals);
+
+  ksn::Pose2 truth({0.05, -0.08}, ksn::make_degree(2.0));
+
+  ksn::Pose2 pose;
+  EXPECT_TRUE(icp.align(observe(points, truth), pose));
+  EXPECT_NEAR(pose.get_position().x, 0.05, 1e-3);
+  EXPECT_NEAR(pose.get_position().y, -0.08, 1e-3);
+}
+
+TEST(Icp2Test, Limits)
+{
+  auto source = observe(field_model(0.15), ksn::Pose2({0.3, -0.2}, ksn::make_degree(6.0)));
+
+  ksn::Icp2 icp;
+  icp.set_target(field_model(0.05));
+  icp.set_max_iterations(2);
+
+  ksn::Pose2 pose;
+  EXPECT_FALSE(icp.align(source, pose));
+  EXPECT_EQ(icp.get_iterations(), 2u);
+
+  // Always past the limit after the first iteration.
+  icp.set_max_iterations(100);
+  icp.set_time_limit(1e-12);
+
+  pose = ksn::Pose2();
+  EXPECT_FALSE(icp.align(source, pose));
+  EXPECT_EQ(icp.get_iterations(), 1u);
+
+  EXPECT_FALSE(icp.align({}, pose));
+  EXPECT_EQ(icp.get_iterations(), 0u);
+}
@@ -0,0 +1,178 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+template<typename Point>
+std::vector<double> brute_force_squared_distances(
+  const std::vector<Point> & points, const Point & point)
+{
+  std::vector<double> squared_distances;
+  for (const auto & other : points) {
+    squared_distances.push_back((other - point).dot(other - point));
+  }
+
+  return squared_distances;
+}
+
+std::vector<ksn::Point2> random_points_2(size_t count, std::mt19937 & generator)
+{
+  std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+
+  std::vector<ksn::Point2> points(count);
+  for (auto & point : points) {
+    point = ksn::Point2(distribution(generator), distribution(generator));
+  }
+
+  return points;
+}
+
+}  // namespace
+
+TEST(KdTreeTest, Empty)
+{
+  ksn::KdTree<ksn::Point2> tree;
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(tree.nearest({0.0, 0.0}), 0u);
+
+  std::vector<size_t> indices;
+  std::vector<double> squared_distances;
+  tree.nearest({0.0, 0.0}, 3, indices, squared_distances);
+  EXPECT_TRUE(indices.empty());
+}
+
+TEST(KdTreeTest, Nearest)
+{
+  std::mt19937 generator(42);
+  auto points = random_points_2(1000, generator);
+  ksn::KdTree<ksn::Point2> tree(points);
+
+  for (const auto & query : random_points_2(100, generator)) {
+    auto squared_distances = brute_force_squared_distances(points, query);
+    auto expected = std::min_element(squared_distances.begin(), squared_distances.end());
+
+    double squared_distance;
+    size_t index = tree.nearest(query, &squared_distance);
+
+    ASSERT_LT(index, points.size());
+    EXPECT_EQ(index, static_cast<size_t>(expected - squared_distances.begin()));
+    EXPECT_DOUBLE_EQ(squared_distance, *expected);
+  }
+}
+
+TEST(KdTreeTest, KNearest)
+{
+  std::mt19937 generator(7);
+  auto points = random_points_2(500, generator);
+  ksn::KdTree<ksn::Point2> tree(points);
+
+  std::vector<size_t> indices;
+  std::vector<double> squared_distances;
+  for (const auto & query : random_points_2(50, generator)) {
+    auto expected = brute_force_squared_distances(points, query);
+    std::sort(expected.begin(), expected.end());
+
+    tree.nearest(query, 5, indices, squared_distances);
+
+    ASSERT_EQ(indices.size(), 5u);
+    for (size_t i = 0; i < indices.size(); ++i) {
+      EXPECT_DOUBLE_EQ(squared_distances[i], expected[i]);
+      EXPECT_DOUBLE_EQ((points[indices[i]] - query).dot(points[indices[i]] - query), expected[i]);
+    }
+  }
+
+  tree.nearest({0.0, 0.0}, 1000, indices, squared_distances);
+  EXPECT_EQ(indices.size(), points.size());
+}
+
+TEST(KdTreeTest, Within)
+{
+  std::mt19937 generator(3);
+  auto points = random_points_2(500, generator);
+  ksn::KdTree<ksn::Point2> tree(points);
+
+  std::vector<size_t> indices;
+  std::vector<double> squared_distances;
+  for (const auto & query : random_points_2(50, generator)) {
+    auto all = brute_force_squared_distances(points, query);
+
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < all.size(); ++i) {
+      if (all[i] <= 4.0) {
+        expected.push_back(i);
+      }
+    }
+
+    tree.within(query, 2.0, indices, squared_distances);
+    ASSERT_EQ(indices.size(), squared_distances.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+      EXPECT_DOUBLE_EQ(squared_distances[i], all[indices[i]]);
+    }
+
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, expected);
+  }
+}
+
+TEST(KdTreeTest, Point3)
+{
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<double> distribution(-5.0, 5.0);
+
+  std::vector<ksn::Point3> points(300);
+  for (auto & point : points) {
+    point = ksn::Point3(distribution(generator), distribution(generator), distribution(generator));
+  }
+
+  ksn::KdTree<ksn::Point3> tree(points);
+  for (int i = 0; i < 50; ++i) {
+    ksn::Point3 query(distribution(generator), distribution(generator), distribution(generator));
+
+    auto squared_distances = brute_force_squared_distances(points, query);
+    auto expected = std::min_element(squared_distances.begin(), squared_distances.end());
+
+    EXPECT_EQ(tree.nearest(query), static_cast<size_t>(expected - squared_distances.begin()));
+  }
+}
+
+TEST(KdTreeTest, Rebuild)
+{
+  std::mt19937 generator(5);
+  ksn::KdTree<ksn::Point2> tree(random_points_2(200, generator));
+
+  auto points = random_points_2(200, generator);
+  tree.build(points);
+  EXPECT_EQ(tree.size(), points.size());
+
+  EXPECT_EQ(tree.nearest(points[17]), 17u);
+
+  tree.build(random_points_2(50, generator));
+  EXPECT_EQ(tree.size(), 50u);
+}
@@ -0,0 +1,191 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+// Camera half a meter above the field, facing the x axis and pitched down by 45 degrees.
+ksn::PinholeCamera make_camera()
+{
+  ksn::PinholeCamera camera(500.0, 500.0, 320.0, 240.0);
+  camera.set_distortion(-0.2, 0.05, 0.001, -0.002, 0.01);
+
+  double a = std::sqrt(0.5);
+  auto matrix = ksn::Matrix<4, 4>::identity();
+  matrix[0][0] = 0.0;
+  matrix[1][0] = -1.0;
+  matrix[2][0] = 0.0;
+  matrix[0][1] = -a;
+  matrix[1][1] = 0.0;
+  matrix[2][1] = -a;
+  matrix[0][2] = a;
+  matrix[1][2] = 0.0;
+  matrix[2][2] = -a;
+
+  camera.set_pose(ksn::DualQuaternion<double>(ksn::rotation_quaternion(matrix), {0.0, 0.0, 0.5}));
+
+  return camera;
+}
+
+}  // namespace
+
+TEST(PinholeCameraTest, InvalidFocalLength)
+{
+  EXPECT_THROW(ksn::PinholeCamera(0.0, 500.0, 320.0, 240.0), std::invalid_argument);
+}
+
+TEST(PinholeCameraTest, UndistortInvertsDistort)
+{
+  auto camera = make_camera();
+
+  for (double x = -0.5; x <= 0.5; x += 0.25) {
+    for (double y = -0.4; y <= 0.4; y += 0.2) {
+      auto point = camera.undistort(camera.distort({x, y}));
+      EXPECT_NEAR(point.x, x, 1e-9);
+      EXPECT_NEAR(point.y, y, 1e-9);
+    }
+  }
+}
+
+TEST(PinholeCameraTest, ProjectCenter)
+{
+  ksn::PinholeCamera camera(500.0, 500.0, 320.0, 240.0);
+
+  ksn::Point2 pixel;
+  ASSERT_TRUE(camera.project({0.0, 0.0, 2.0}, pixel));
+  EXPECT_DOUBLE_EQ(pixel.x, 320.0);
+  EXPECT_DOUBLE_EQ(pixel.y, 240.0);
+
+  ASSERT_TRUE(camera.project({0.2, -0.1, 2.0}, pixel));
+  EXPECT_DOUBLE_EQ(pixel.x, 370.0);
+  EXPECT_DOUBLE_EQ(pixel.y, 215.0);
+
+  EXPECT_FALSE(camera.project({0.0, 0.0, -1.0}, pixel));
+}
+
+TEST(PinholeCameraTest, RoundTrip)
+{
+  auto camera = make_camera();
+
+  ksn::Point2 pixel;
+  ASSERT_TRUE(camera.project({0.5, 0.0, 0.0}, pixel));
+  EXPECT_NEAR(pixel.x, 320.0, 1e-9);
+  EXPECT_NEAR(pixel.y, 240.0, 1e-9);
+
+  for (double x = 0.3; x < 1.5; x += 0.2) {
+    for (double y = -0.3; y <= 0.3; y += 0.15) {
+      ASSERT_TRUE(camera.project({x, y, 0.0}, pixel));
+
+      ksn::Point2 point;
+      ASSERT_TRUE(camera.unproject_to_plane(pixel, point));
+      EXPECT_NEAR(point.x, x, 1e-6);
+      EXPECT_NEAR(point.y, y, 1e-6);
+    }
+  }
+
+  // Rays above the horizon never reach the field.
+  camera.set_distortion(0.0, 0.0, 0.0, 0.0);
+  ksn::Point2 point;
+  EXPECT_TRUE(camera.unproject_to_plane({320.0, -200.0}, point));
+  EXPECT_FALSE(camera.unproject_to_plane({320.0, -300.0}, point));
+}
+
+TEST(PinholeCameraTest, Batch)
+{
+  auto camera = make_camera();
+  camera.set_distortion(-0.05, 0.01, 0.001, -0.002);
+
+  ksn::PointCloud3 points;
+  for (double x = -0.5; x < 1.5; x += 0.1) {
+    points.push_back({x, 0.1, 0.0});
+  }
+
+  ksn::PointCloud2 pixels;
+  camera.project(points, pixels);
+  ASSERT_EQ(pixels.size(), points.size());
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    ksn::Point2 pixel;
+    if (camera.project(points[i], pixel)) {
+      EXPECT_NEAR(pixels[i].x, pixel.x, 1e-9);
+      EXPECT_NEAR(pixels[i].y, pixel.y, 1e-9);
+    } else {
+      EXPECT_TRUE(std::isnan(pixels[i].x));
+      EXPECT_TRUE(std::isnan(pixels[i].y));
+    }
+  }
+
+  ksn::PointCloud2 valid;
+  for (size_t i = 0; i < pixels.size(); ++i) {
+    if (!std::isnan(pixels[i].x)) {
+      valid.push_back(pixels[i]);
+    }
+  }
+  valid.push_back({320.0, -1000.0});
+
+  ksn::PointCloud2 grounds;
+  camera.unproject_to_plane(valid, grounds);
+  ASSERT_EQ(grounds.size(), valid.size());
+
+  for (size_t i = 0; i + 1 < valid.size(); ++i) {
+    ksn::Point2 point;
+    ASSERT_TRUE(camera.unproject_to_plane(valid[i], point));
+    EXPECT_NEAR(grounds[i].x, point.x, 1e-9);
+    EXPECT_NEAR(grounds[i].y, point.y, 1e-9);
+  }
+
+  EXPECT_TRUE(std::isnan(grounds[valid.size() - 1].x));
+}
+
+TEST(PinholeCameraTest, UndistortionTable)
+{
+  auto camera = make_camera();
+  auto reference = make_camera();
+
+  EXPECT_THROW(camera.build_undistortion_table(1, 480), std::invalid_argument);
+  camera.build_undistortion_table(640, 480);
+
+  for (double u = 10.5; u < 640.0; u += 97.3) {
+    for (double v = 250.25; v < 480.0; v += 41.7) {
+      ksn::Point2 point;
+      ksn::Point2 expected;
+      ASSERT_TRUE(camera.unproject_to_plane({u, v}, point));
+      ASSERT_TRUE(reference.unproject_to_plane({u, v}, expected));
+      EXPECT_NEAR(point.x, expected.x, 1e-4);
+      EXPECT_NEAR(point.y, expected.y, 1e-4);
+    }
+  }
+
+  // Whole pixels land exactly on table entries.
+  ksn::Point2 point;
+  ksn::Point2 expected;
+  ASSERT_TRUE(camera.unproject_to_plane({100.0, 400.0}, point));
+  ASSERT_TRUE(reference.unproject_to_plane({100.0, 400.0}, expected));
+  EXPECT_DOUBLE_EQ(point.x, expected.x);
+  EXPECT_DOUBLE_EQ(point.y, expected.y);
+}
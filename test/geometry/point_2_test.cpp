@@ -18,6 +18,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <type_traits>
+
 #include "../comparison/point_2.hpp"
 
 namespace ksn = keisan;
@@ -170,3 +172,13 @@ TEST(Point2Test, Rotation)
   EXPECT_POINT2_EQ(
     point.rotate_from(ksn::make_degree(90.0), {1.0, -1.0}), ksn::Point2(-3.0, 2.0));
 }
+
+TEST(Point2Test, TriviallyCopyable)
+{
+  EXPECT_TRUE(std::is_trivially_copyable<ksn::Point2>::value);
+
+  constexpr auto point = ksn::Point2(1.0, 2.0).scale_from(2.0, ksn::Point2(1.0, 0.0));
+  static_assert(point.cross(ksn::Point2(1.0, 0.0)) == -4.0, "constexpr cross product");
+
+  EXPECT_POINT2_EQ(point, ksn::Point2(1.0, 4.0));
+}
@@ -18,6 +18,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <type_traits>
+
 #include "../comparison/point_3.hpp"
 
 namespace ksn = keisan;
@@ -137,3 +139,41 @@ TEST(Point3Test, CrossProduct)
 
   EXPECT_POINT3_EQ(a.cross(b), ksn::Point3(7.0, -14.0, 7.0));
 }
+
+TEST(Point3Test, QuaternionRotation)
+{
+  auto point = ksn::Point3(1.0, 2.0, 3.0);
+
+  EXPECT_POINT3_EQ(point.rotate(ksn::Quaternion<double>::identity()), point);
+
+  auto yaw = ksn::Euler<double>(
+    ksn::make_degree(0.0), ksn::make_degree(0.0), ksn::make_degree(90.0)).quaternion();
+  auto rotated = point.rotate(yaw);
+
+  EXPECT_NEAR(rotated.x, -2.0, 1e-12);
+  EXPECT_NEAR(rotated.y, 1.0, 1e-12);
+  EXPECT_NEAR(rotated.z, 3.0, 1e-12);
+
+  auto zero = ksn::make_degree(0.0);
+  auto roll = ksn::make_degree(20.0);
+  auto pitch = ksn::make_degree(-35.0);
+  auto expected = point
+    .rotate(ksn::Euler<double>(roll, zero, zero).quaternion())
+    .rotate(ksn::Euler<double>(zero, pitch, zero).quaternion())
+    .rotate(yaw);
+  rotated = point.rotate(ksn::Euler<double>(roll, pitch, ksn::make_degree(90.0)).quaternion());
+
+  EXPECT_NEAR(rotated.x, expected.x, 1e-12);
+  EXPECT_NEAR(rotated.y, expected.y, 1e-12);
+  EXPECT_NEAR(rotated.z, expected.z, 1e-12);
+}
+
+TEST(Point3Test, TriviallyCopyable)
+{
+  EXPECT_TRUE(std::is_trivially_copyable<ksn::Point3>::value);
+
+  constexpr auto point = ksn::Point3(1.0, 2.0, 3.0) * 2.0 - ksn::Point3::zero();
+  static_assert(point.dot(ksn::Point3(1.0, 0.0, 0.0)) == 2.0, "constexpr dot product");
+
+  EXPECT_POINT3_EQ(point, ksn::Point3(2.0, 4.0, 6.0));
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <vector>
+
+#include "../comparison/point_2.hpp"
+
+namespace ksn = keisan;
+
+TEST(PointCloud2Test, FromPoints)
+{
+  std::vector<ksn::Point2> points = {{1.0, 2.0}, {-3.0, 4.0}, {5.0, -6.0}};
+  ksn::PointCloud2 cloud(points);
+
+  ASSERT_EQ(cloud.size(), points.size());
+  EXPECT_DOUBLE_EQ(cloud.xs()[1], -3.0);
+  EXPECT_DOUBLE_EQ(cloud.ys()[2], -6.0);
+
+  auto result = cloud.points();
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_POINT2_EQ(result[i], points[i]);
+  }
+}
+
+TEST(PointCloud2Test, ElementAccess)
+{
+  ksn::PointCloud2 cloud;
+  EXPECT_TRUE(cloud.empty());
+
+  cloud.push_back({1.0, 2.0});
+  cloud.push_back({3.0, 4.0});
+  cloud[0] = ksn::Point2(-1.0, -2.0);
+
+  ksn::Point2 point = cloud[1];
+  EXPECT_POINT2_EQ(point, ksn::Point2(3.0, 4.0));
+  EXPECT_POINT2_EQ(cloud[0], ksn::Point2(-1.0, -2.0));
+
+  cloud.clear();
+  EXPECT_TRUE(cloud.empty());
+}
+
+TEST(PointCloud2Test, Transformation)
+{
+  std::vector<ksn::Point2> points = {{1.0, 2.0}, {-3.0, 4.0}, {5.0, -6.0}, {0.5, 0.25}, {7.0, 8.0}};
+  ksn::PointCloud2 cloud(points);
+
+  auto angle = ksn::make_degree(30.0);
+  cloud.translate({1.0, -1.0});
+  cloud.scale({2.0, 0.5});
+  cloud.rotate(angle);
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    auto expected = points[i].translate({1.0, -1.0}).scale({2.0, 0.5}).rotate(angle);
+    EXPECT_POINT2_EQ(cloud[i], expected);
+  }
+}
+
+TEST(PointCloud2Test, Statistics)
+{
+  ksn::PointCloud2 cloud({{1.0, 1.0}, {3.0, 1.0}, {3.0, 5.0}, {1.0, 5.0}});
+
+  EXPECT_POINT2_EQ(cloud.centroid(), ksn::Point2(2.0, 3.0));
+
+  auto covariance = cloud.covariance();
+  EXPECT_DOUBLE_EQ(covariance[0][0], 1.0);
+  EXPECT_DOUBLE_EQ(covariance[0][1], 0.0);
+  EXPECT_DOUBLE_EQ(covariance[1][1], 4.0);
+
+  ksn::Point2 min, max;
+  cloud.bounds(min, max);
+  EXPECT_POINT2_EQ(min, ksn::Point2(1.0, 1.0));
+  EXPECT_POINT2_EQ(max, ksn::Point2(3.0, 5.0));
+}
+
+TEST(PointCloud2Test, Nearest)
+{
+  ksn::PointCloud2 cloud;
+  EXPECT_EQ(cloud.nearest({0.0, 0.0}), cloud.size());
+
+  for (int i = 0; i < 1000; ++i) {
+    cloud.push_back({i * 0.5, -i * 0.25});
+  }
+
+  double squared_distance;
+  EXPECT_EQ(cloud.nearest({300.1, -150.0}, &squared_distance), 600u);
+  EXPECT_NEAR(squared_distance, 0.01, 1e-9);
+}
+
+TEST(PointCloud2Test, Polar)
+{
+  ksn::PointCloud2 cloud({{3.0, 4.0}, {0.0, -2.0}});
+
+  std::vector<double> magnitudes;
+  cloud.magnitudes(magnitudes);
+  ASSERT_EQ(magnitudes.size(), 2u);
+  EXPECT_DOUBLE_EQ(magnitudes[0], 5.0);
+  EXPECT_DOUBLE_EQ(magnitudes[1], 2.0);
+
+  std::vector<ksn::Angle<double>> directions;
+  cloud.directions(directions);
+  ASSERT_EQ(directions.size(), 2u);
+  EXPECT_DOUBLE_EQ(directions[0].degree(), ksn::Point2(3.0, 4.0).direction().degree());
+  EXPECT_DOUBLE_EQ(directions[1].degree(), -90.0);
+
+  std::vector<ksn::Angle<double>> fast_directions;
+  cloud.fast_directions(fast_directions);
+  ASSERT_EQ(fast_directions.size(), 2u);
+  EXPECT_NEAR(fast_directions[0].radian(), directions[0].radian(), 1e-7);
+  EXPECT_NEAR(fast_directions[1].radian(), directions[1].radian(), 1e-7);
+
+  cloud.fast_directions<ksn::Precision::Low>(fast_directions);
+  EXPECT_NEAR(fast_directions[0].radian(), directions[0].radian(), 1e-4);
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <vector>
+
+#include "../comparison/point_3.hpp"
+
+namespace ksn = keisan;
+
+TEST(PointCloud3Test, FromPoints)
+{
+  std::vector<ksn::Point3> points = {{1.0, 2.0, 3.0}, {-3.0, 4.0, -5.0}, {5.0, -6.0, 7.0}};
+  ksn::PointCloud3 cloud(points);
+
+  ASSERT_EQ(cloud.size(), points.size());
+  EXPECT_DOUBLE_EQ(cloud.zs()[1], -5.0);
+
+  auto result = cloud.points();
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_POINT3_EQ(result[i], points[i]);
+  }
+
+  cloud[2] = ksn::Point3(0.0, 1.0, 2.0);
+  EXPECT_POINT3_EQ(cloud[2], ksn::Point3(0.0, 1.0, 2.0));
+}
+
+TEST(PointCloud3Test, Transformation)
+{
+  std::vector<ksn::Point3> points = {
+    {1.0, 2.0, 3.0}, {-3.0, 4.0, -5.0}, {5.0, -6.0, 7.0}, {0.5, 0.25, 0.125}, {7.0, 8.0, 9.0}};
+  ksn::PointCloud3 cloud(points);
+
+  auto rotation = ksn::Quaternion<double>(0.1, -0.3, 0.5, 0.8).normalize();
+  cloud.translate({1.0, -1.0, 2.0});
+  cloud.scale(2.0);
+  cloud.rotate(rotation);
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    auto expected = ((points[i] + ksn::Point3(1.0, -1.0, 2.0)) * 2.0).rotate(rotation);
+    EXPECT_POINT3_EQ(cloud[i], expected);
+  }
+}
+
+TEST(PointCloud3Test, Statistics)
+{
+  ksn::PointCloud3 cloud({{1.0, 1.0, 0.0}, {3.0, 1.0, 0.0}, {3.0, 5.0, 2.0}, {1.0, 5.0, 2.0}});
+
+  EXPECT_POINT3_EQ(cloud.centroid(), ksn::Point3(2.0, 3.0, 1.0));
+
+  auto covariance = cloud.covariance();
+  EXPECT_DOUBLE_EQ(covariance[0][0], 1.0);
+  EXPECT_DOUBLE_EQ(covariance[1][1], 4.0);
+  EXPECT_DOUBLE_EQ(covariance[2][2], 1.0);
+  EXPECT_DOUBLE_EQ(covariance[1][2], 2.0);
+  EXPECT_DOUBLE_EQ(covariance[2][1], 2.0);
+
+  ksn::Point3 min, max;
+  cloud.bounds(min, max);
+  EXPECT_POINT3_EQ(min, ksn::Point3(1.0, 1.0, 0.0));
+  EXPECT_POINT3_EQ(max, ksn::Point3(3.0, 5.0, 2.0));
+}
+
+TEST(PointCloud3Test, Nearest)
+{
+  ksn::PointCloud3 cloud;
+  EXPECT_EQ(cloud.nearest({0.0, 0.0, 0.0}), cloud.size());
+
+  for (int i = 0; i < 1000; ++i) {
+    cloud.push_back({i * 0.5, -i * 0.25, 1.0});
+  }
+
+  double squared_distance;
+  EXPECT_EQ(cloud.nearest({300.0, -150.0, 1.1}, &squared_distance), 600u);
+  EXPECT_NEAR(squared_distance, 0.01, 1e-9);
+
+  std::vector<double> magnitudes;
+  cloud.magnitudes(magnitudes);
+  EXPECT_DOUBLE_EQ(magnitudes[0], 1.0);
+}
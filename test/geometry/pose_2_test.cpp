@@ -0,0 +1,152 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <vector>
+
+#include "../comparison/point_2.hpp"
+
+namespace ksn = keisan;
+
+TEST(Pose2Test, Identity)
+{
+  auto pose = ksn::Pose2::identity();
+
+  EXPECT_POINT2_EQ(pose.transform({3.0, -4.0}), ksn::Point2(3.0, -4.0));
+  EXPECT_DOUBLE_EQ(pose.get_cos(), 1.0);
+  EXPECT_DOUBLE_EQ(pose.get_sin(), 0.0);
+}
+
+TEST(Pose2Test, Transform)
+{
+  ksn::Pose2 pose({1.0, 2.0}, ksn::make_degree(90.0));
+  ksn::Point2 point(3.0, 4.0);
+
+  auto expected = point.rotate(ksn::make_degree(90.0)).translate({1.0, 2.0});
+  EXPECT_POINT2_EQ(pose.transform(point), expected);
+  EXPECT_POINT2_EQ(pose.inverse_transform(expected), point);
+
+  auto matrix = pose.matrix() * static_cast<ksn::Vector<3>>(point);
+  EXPECT_POINT2_EQ(ksn::Point2(matrix), expected);
+}
+
+TEST(Pose2Test, ComposeAndInverse)
+{
+  ksn::Pose2 a({1.0, 2.0}, ksn::make_degree(150.0));
+  ksn::Pose2 b({-3.0, 0.5}, ksn::make_degree(120.0));
+  ksn::Point2 point(0.25, -1.5);
+
+  auto ab = a * b;
+  auto result = ab.transform(point);
+  auto expected = a.transform(b.transform(point));
+  EXPECT_NEAR(result.x, expected.x, 1e-9);
+  EXPECT_NEAR(result.y, expected.y, 1e-9);
+  EXPECT_NEAR(ab.get_orientation().degree(), -90.0, 1e-9);
+
+  auto identity = a * a.inverse();
+  EXPECT_NEAR(identity.get_position().x, 0.0, 1e-9);
+  EXPECT_NEAR(identity.get_position().y, 0.0, 1e-9);
+  EXPECT_NEAR(identity.get_orientation().degree(), 0.0, 1e-9);
+
+  auto c = a;
+  c *= b;
+  EXPECT_TRUE(c == ab);
+  EXPECT_FALSE(c != ab);
+}
+
+TEST(Pose2Test, RepeatedComposition)
+{
+  ksn::Pose2 step({0.01, 0.0}, ksn::make_degree(0.7));
+  auto pose = ksn::Pose2::identity();
+
+  for (int i = 0; i < 100000; ++i) {
+    pose *= step;
+  }
+
+  auto expected = ksn::make_degree(70000.0).normalize();
+  EXPECT_NEAR(pose.get_orientation().degree(), expected.degree(), 1e-6);
+  EXPECT_NEAR(pose.get_cos(), expected.cos(), 1e-9);
+  EXPECT_NEAR(pose.get_sin(), expected.sin(), 1e-9);
+}
+
+TEST(Pose2Test, BatchTransform)
+{
+  ksn::Pose2 pose({-1.0, 0.5}, ksn::make_degree(-35.0));
+  std::vector<ksn::Point2> points = {{1.0, 2.0}, {-3.0, 4.0}, {5.0, -6.0}, {0.0, 0.0}};
+
+  std::vector<ksn::Point2> results;
+  pose.transform(points, results);
+
+  ksn::PointCloud2 cloud(points);
+  pose.transform(cloud);
+
+  ASSERT_EQ(results.size(), points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_POINT2_EQ(results[i], pose.transform(points[i]));
+    EXPECT_POINT2_EQ(cloud[i], pose.transform(points[i]));
+  }
+}
+
+TEST(Pose2Test, BatchTransformAfterComposition)
+{
+  ksn::Pose2 step({0.02, -0.01}, ksn::make_degree(3.3));
+  auto pose = ksn::Pose2({1.0, 2.0}, ksn::make_degree(10.0));
+  for (int i = 0; i < 250; ++i) {
+    pose *= step;
+  }
+
+  std::vector<ksn::Point2> points;
+  for (int i = 0; i < 19; ++i) {
+    points.push_back({i * 0.7 - 5.0, 3.0 - i * 0.3});
+  }
+
+  ksn::PointCloud2 cloud(points);
+  pose.transform(cloud);
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    auto expected = pose.transform(points[i]);
+    EXPECT_DOUBLE_EQ(cloud[i].x, expected.x);
+    EXPECT_DOUBLE_EQ(cloud[i].y, expected.y);
+  }
+
+  cloud = ksn::PointCloud2(points);
+  cloud.rotate(pose.get_sin(), pose.get_cos());
+  for (size_t i = 0; i < points.size(); ++i) {
+    auto expected = pose.transform(points[i]) - pose.get_position();
+    EXPECT_NEAR(cloud[i].x, expected.x, 1e-12);
+    EXPECT_NEAR(cloud[i].y, expected.y, 1e-12);
+  }
+}
+
+TEST(Pose2Test, BatchCompose)
+{
+  std::vector<ksn::Pose2> poses = {
+    {{1.0, 2.0}, ksn::make_degree(10.0)},
+    {{-3.0, 4.0}, ksn::make_degree(175.0)},
+    {{0.0, -1.0}, ksn::make_degree(-170.0)}};
+  ksn::Pose2 delta({0.5, 0.1}, ksn::make_degree(20.0));
+
+  std::vector<ksn::Pose2> results;
+  ksn::compose(poses, delta, results);
+
+  ASSERT_EQ(results.size(), poses.size());
+  for (size_t i = 0; i < poses.size(); ++i) {
+    EXPECT_TRUE(results[i] == poses[i] * delta);
+  }
+}
@@ -0,0 +1,187 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <limits>
+#include <vector>
+
+#include "../comparison/point_2.hpp"
+
+namespace ksn = keisan;
+
+TEST(Primitive2Test, Properties)
+{
+  ksn::Segment2 segment({1.0, 1.0}, {4.0, 5.0});
+  EXPECT_DOUBLE_EQ(segment.squared_length(), 25.0);
+  EXPECT_DOUBLE_EQ(segment.length(), 5.0);
+  EXPECT_POINT2_EQ(segment.point_at(0.5), ksn::Point2(2.5, 3.0));
+
+  ksn::Circle2 circle({0.0, 0.0}, 2.0);
+  EXPECT_TRUE(circle.contains({1.0, 1.0}));
+  EXPECT_TRUE(circle.contains({0.0, 2.0}));
+  EXPECT_FALSE(circle.contains({2.0, 1.0}));
+
+  ksn::Polygon2 square({{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}});
+  EXPECT_DOUBLE_EQ(square.signed_area(), 4.0);
+
+  ksn::Polygon2 clockwise({{0.0, 0.0}, {0.0, 2.0}, {2.0, 2.0}, {2.0, 0.0}});
+  EXPECT_DOUBLE_EQ(clockwise.signed_area(), -4.0);
+  EXPECT_DOUBLE_EQ(clockwise.area(), 4.0);
+}
+
+TEST(Primitive2Test, PolygonContains)
+{
+  ksn::Polygon2 concave({{0.0, 0.0}, {4.0, 0.0}, {4.0, 4.0}, {2.0, 1.0}, {0.0, 4.0}});
+
+  EXPECT_TRUE(concave.contains({1.0, 0.5}));
+  EXPECT_TRUE(concave.contains({3.5, 3.0}));
+  EXPECT_FALSE(concave.contains({2.0, 3.0}));
+  EXPECT_FALSE(concave.contains({5.0, 1.0}));
+  EXPECT_FALSE(concave.contains({-1.0, 1.0}));
+}
+
+TEST(Primitive2Test, Distance)
+{
+  ksn::Line2 line = ksn::Line2::from_points({0.0, 0.0}, {2.0, 0.0});
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(line, {-5.0, 3.0}), 9.0);
+  EXPECT_POINT2_EQ(ksn::closest_point(line, {-5.0, 3.0}), ksn::Point2(-5.0, 0.0));
+
+  ksn::Segment2 segment({0.0, 0.0}, {2.0, 0.0});
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(segment, {-3.0, 4.0}), 25.0);
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(segment, {1.0, -2.0}), 4.0);
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(segment, {5.0, 4.0}), 25.0);
+  EXPECT_POINT2_EQ(ksn::closest_point(segment, {5.0, 4.0}), ksn::Point2(2.0, 0.0));
+  EXPECT_POINT2_EQ(ksn::closest_point(segment, {1.5, 4.0}), ksn::Point2(1.5, 0.0));
+
+  ksn::Ray2 ray({0.0, 0.0}, {1.0, 0.0});
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(ray, {-3.0, 4.0}), 25.0);
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(ray, {10.0, 4.0}), 16.0);
+  EXPECT_POINT2_EQ(ksn::closest_point(ray, {10.0, 4.0}), ksn::Point2(10.0, 0.0));
+
+  ksn::Polygon2 square({{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}});
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(square, {1.0, 1.0}), 0.0);
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(square, {1.0, 5.0}), 9.0);
+}
+
+TEST(Primitive2Test, LineIntersection)
+{
+  ksn::Point2 intersection;
+
+  ksn::Line2 a({0.0, 0.0}, {1.0, 1.0});
+  ksn::Line2 b({2.0, 0.0}, {-1.0, 1.0});
+  EXPECT_TRUE(ksn::intersect(a, b, &intersection));
+  EXPECT_POINT2_EQ(intersection, ksn::Point2(1.0, 1.0));
+
+  EXPECT_FALSE(ksn::intersect(a, ksn::Line2({1.0, 0.0}, {2.0, 2.0})));
+
+  EXPECT_TRUE(ksn::intersect(a, ksn::Segment2({0.0, 4.0}, {4.0, 0.0}), &intersection));
+  EXPECT_POINT2_EQ(intersection, ksn::Point2(2.0, 2.0));
+  EXPECT_FALSE(ksn::intersect(a, ksn::Segment2({0.0, 4.0}, {1.0, 3.0})));
+}
+
+TEST(Primitive2Test, SegmentIntersection)
+{
+  ksn::Point2 intersection;
+
+  ksn::Segment2 a({0.0, 0.0}, {4.0, 4.0});
+  EXPECT_TRUE(ksn::intersect(a, ksn::Segment2({0.0, 4.0}, {4.0, 0.0}), &intersection));
+  EXPECT_POINT2_EQ(intersection, ksn::Point2(2.0, 2.0));
+
+  EXPECT_TRUE(ksn::intersect(a, ksn::Segment2({4.0, 4.0}, {6.0, 0.0})));
+  EXPECT_FALSE(ksn::intersect(a, ksn::Segment2({0.0, 4.0}, {1.0, 3.0})));
+  EXPECT_FALSE(ksn::intersect(a, ksn::Segment2({1.0, 0.0}, {5.0, 4.0})));
+
+  EXPECT_TRUE(ksn::intersect(a, ksn::Segment2({6.0, 6.0}, {3.0, 3.0}), &intersection));
+  EXPECT_POINT2_EQ(intersection, ksn::Point2(3.0, 3.0));
+  EXPECT_FALSE(ksn::intersect(a, ksn::Segment2({5.0, 5.0}, {6.0, 6.0})));
+}
+
+TEST(Primitive2Test, RayIntersection)
+{
+  ksn::Point2 intersection;
+
+  ksn::Ray2 ray({0.0, 0.0}, {2.0, 0.0});
+  EXPECT_TRUE(ksn::intersect(ray, ksn::Segment2({3.0, -1.0}, {3.0, 1.0}), &intersection));
+  EXPECT_POINT2_EQ(intersection, ksn::Point2(3.0, 0.0));
+  EXPECT_FALSE(ksn::intersect(ray, ksn::Segment2({-3.0, -1.0}, {-3.0, 1.0})));
+
+  EXPECT_TRUE(ksn::intersect(ray, ksn::Circle2({5.0, 0.0}, 1.0), &intersection));
+  EXPECT_POINT2_EQ(intersection, ksn::Point2(4.0, 0.0));
+  EXPECT_TRUE(ksn::intersect(ray, ksn::Circle2({0.5, 0.0}, 1.0), &intersection));
+  EXPECT_POINT2_EQ(intersection, ksn::Point2(0.0, 0.0));
+  EXPECT_FALSE(ksn::intersect(ray, ksn::Circle2({-5.0, 0.0}, 1.0)));
+  EXPECT_FALSE(ksn::intersect(ray, ksn::Circle2({5.0, 2.0}, 1.0)));
+
+  // Without direction the ray is only its origin.
+  ksn::Ray2 point({0.0, 0.0}, {0.0, 0.0});
+  EXPECT_FALSE(ksn::intersect(point, ksn::Circle2({5.0, 0.0}, 1.0), &intersection));
+  EXPECT_TRUE(ksn::intersect(point, ksn::Circle2({0.5, 0.0}, 1.0), &intersection));
+  EXPECT_POINT2_EQ(intersection, ksn::Point2(0.0, 0.0));
+}
+
+TEST(Primitive2Test, ShapeIntersection)
+{
+  ksn::Circle2 circle({0.0, 0.0}, 1.0);
+  EXPECT_TRUE(ksn::intersect(ksn::Segment2({-2.0, 0.5}, {2.0, 0.5}), circle));
+  EXPECT_FALSE(ksn::intersect(ksn::Segment2({-2.0, 1.5}, {2.0, 1.5}), circle));
+  EXPECT_FALSE(ksn::intersect(ksn::Segment2({2.0, 0.0}, {3.0, 0.0}), circle));
+
+  ksn::Polygon2 square({{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}});
+  EXPECT_TRUE(ksn::intersect(ksn::Segment2({0.5, 0.5}, {1.0, 1.0}), square));
+  EXPECT_TRUE(ksn::intersect(ksn::Segment2({-1.0, 1.0}, {3.0, 1.0}), square));
+  EXPECT_FALSE(ksn::intersect(ksn::Segment2({-1.0, 3.0}, {3.0, 3.0}), square));
+}
+
+TEST(Primitive2Test, BatchOneToMany)
+{
+  std::vector<ksn::Segment2> segments = {
+    {{3.0, -1.0}, {3.0, 1.0}},
+    {{-3.0, -1.0}, {-3.0, 1.0}},
+    {{1.0, 1.0}, {5.0, 1.0}},
+    {{2.0, 2.0}, {2.0, 2.0}},
+    {{6.0, 1.0}, {6.0, -3.0}}};
+
+  ksn::Point2 point(0.5, 0.5);
+  std::vector<double> distances;
+  ksn::squared_distances(point, segments, distances);
+
+  ASSERT_EQ(distances.size(), segments.size());
+  for (size_t i = 0; i < segments.size(); ++i) {
+    EXPECT_DOUBLE_EQ(distances[i], ksn::squared_distance(segments[i], point));
+  }
+
+  ksn::Ray2 ray({0.0, 0.0}, {2.0, 0.0});
+  std::vector<double> parameters;
+  ksn::intersect(ray, segments, parameters);
+
+  ASSERT_EQ(parameters.size(), segments.size());
+  EXPECT_DOUBLE_EQ(parameters[0], 1.5);
+  EXPECT_EQ(parameters[1], std::numeric_limits<double>::infinity());
+  EXPECT_EQ(parameters[2], std::numeric_limits<double>::infinity());
+  EXPECT_EQ(parameters[3], std::numeric_limits<double>::infinity());
+  EXPECT_DOUBLE_EQ(parameters[4], 3.0);
+
+  std::vector<size_t> indices;
+  ksn::intersect(ksn::Segment2({0.0, 0.0}, {4.0, 0.0}), segments, indices);
+  EXPECT_EQ(indices, std::vector<size_t>({0}));
+
+  std::vector<ksn::Circle2> circles = {{{0.0, 1.0}, 0.5}, {{2.0, 0.5}, 0.5}, {{5.0, 0.0}, 1.0}};
+  ksn::intersect(ksn::Segment2({0.0, 0.0}, {4.0, 0.0}), circles, indices);
+  EXPECT_EQ(indices, std::vector<size_t>({1, 2}));
+}
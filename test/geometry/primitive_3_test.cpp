@@ -0,0 +1,142 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <limits>
+
+#include "../comparison/point_3.hpp"
+
+namespace ksn = keisan;
+
+TEST(Primitive3Test, Properties)
+{
+  ksn::Segment3 segment({1.0, 1.0, 1.0}, {3.0, 4.0, 7.0});
+  EXPECT_DOUBLE_EQ(segment.squared_length(), 49.0);
+  EXPECT_DOUBLE_EQ(segment.length(), 7.0);
+  EXPECT_POINT3_EQ(segment.point_at(0.5), ksn::Point3(2.0, 2.5, 4.0));
+
+  ksn::Capsule3 capsule({0.0, 0.0, 0.0}, {0.0, 0.0, 2.0}, 0.5);
+  EXPECT_TRUE(capsule.contains({0.5, 0.0, 1.0}));
+  EXPECT_TRUE(capsule.contains({0.0, 0.0, 2.5}));
+  EXPECT_FALSE(capsule.contains({0.4, 0.0, 2.4}));
+
+  auto bounds = capsule.bounds();
+  EXPECT_POINT3_EQ(bounds.min, ksn::Point3(-0.5, -0.5, -0.5));
+  EXPECT_POINT3_EQ(bounds.max, ksn::Point3(0.5, 0.5, 2.5));
+
+  ksn::Sphere3 sphere({1.0, 2.0, 3.0}, 1.0);
+  EXPECT_TRUE(sphere.contains({1.0, 2.0, 4.0}));
+  EXPECT_FALSE(sphere.contains({1.0, 3.0, 4.0}));
+  EXPECT_POINT3_EQ(sphere.bounds().max, ksn::Point3(2.0, 3.0, 4.0));
+}
+
+TEST(Primitive3Test, PointDistance)
+{
+  ksn::Segment3 segment({0.0, 0.0, 0.0}, {2.0, 0.0, 0.0});
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(segment, {1.0, 3.0, 4.0}), 25.0);
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(segment, {-1.0, 0.0, 1.0}), 2.0);
+  EXPECT_POINT3_EQ(ksn::closest_point(segment, {5.0, 1.0, 0.0}), ksn::Point3(2.0, 0.0, 0.0));
+  EXPECT_POINT3_EQ(ksn::closest_point(segment, {0.5, 1.0, 0.0}), ksn::Point3(0.5, 0.0, 0.0));
+}
+
+TEST(Primitive3Test, SegmentDistance)
+{
+  double s;
+  double t;
+
+  // Skew segments crossing at their middles.
+  ksn::Segment3 a({-1.0, 0.0, 0.0}, {1.0, 0.0, 0.0});
+  ksn::Segment3 b({0.0, -1.0, 1.0}, {0.0, 1.0, 1.0});
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(a, b, &s, &t), 1.0);
+  EXPECT_DOUBLE_EQ(s, 0.5);
+  EXPECT_DOUBLE_EQ(t, 0.5);
+
+  // Closest at the ends of both.
+  ksn::Segment3 c({0.0, 0.0, 0.0}, {1.0, 0.0, 0.0});
+  ksn::Segment3 d({2.0, 1.0, 0.0}, {3.0, 5.0, 0.0});
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(c, d, &s, &t), 2.0);
+  EXPECT_DOUBLE_EQ(s, 1.0);
+  EXPECT_DOUBLE_EQ(t, 0.0);
+
+  // Parallel, and nearly parallel, overlapping segments.
+  ksn::Segment3 e({0.0, 0.0, 0.0}, {2.0, 0.0, 0.0});
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(e, ksn::Segment3({1.0, 1.0, 0.0}, {3.0, 1.0, 0.0})), 1.0);
+  EXPECT_NEAR(
+    ksn::squared_distance(e, ksn::Segment3({1.0, 1.0, 0.0}, {3.0, 1.0, 1e-9})), 1.0, 1e-12);
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(e, ksn::Segment3({3.0, 1.0, 0.0}, {5.0, 1.0, 0.0})), 2.0);
+
+  // Segments of zero length.
+  ksn::Segment3 point({1.0, 2.0, 0.0}, {1.0, 2.0, 0.0});
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(point, e, &s, &t), 4.0);
+  EXPECT_DOUBLE_EQ(t, 0.5);
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(e, point, &s, &t), 4.0);
+  EXPECT_DOUBLE_EQ(s, 0.5);
+  EXPECT_DOUBLE_EQ(ksn::squared_distance(point, point), 0.0);
+}
+
+TEST(Primitive3Test, SegmentDistanceAgainstSampling)
+{
+  ksn::Segment3 segments[] = {
+    {{0.3, -1.2, 0.5}, {1.7, 0.4, -0.8}},
+    {{-0.6, 0.9, 1.1}, {0.8, -0.3, 0.2}},
+    {{1.5, 1.5, 1.5}, {2.5, 0.5, 1.0}},
+    {{-1.0, -1.0, 0.0}, {-0.2, 0.6, 0.4}},
+  };
+
+  for (const auto & a : segments) {
+    for (const auto & b : segments) {
+      double s;
+      double t;
+      double result = ksn::squared_distance(a, b, &s, &t);
+
+      double sampled = std::numeric_limits<double>::infinity();
+      for (int i = 0; i <= 200; ++i) {
+        for (int j = 0; j <= 200; ++j) {
+          auto offset = a.point_at(i / 200.0) - b.point_at(j / 200.0);
+          sampled = std::min(sampled, offset.dot(offset));
+        }
+      }
+
+      EXPECT_LE(result, sampled + 1e-12);
+      EXPECT_NEAR(result, sampled, 1e-3);
+
+      auto offset = a.point_at(s) - b.point_at(t);
+      EXPECT_NEAR(offset.dot(offset), result, 1e-12);
+    }
+  }
+}
+
+TEST(Primitive3Test, Intersection)
+{
+  ksn::Sphere3 sphere({0.0, 0.0, 1.0}, 0.5);
+  EXPECT_TRUE(ksn::intersect(sphere, ksn::Sphere3({0.0, 1.0, 1.0}, 0.5)));
+  EXPECT_FALSE(ksn::intersect(sphere, ksn::Sphere3({0.0, 1.1, 1.0}, 0.5)));
+
+  ksn::Capsule3 capsule({-1.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, 0.25);
+  EXPECT_TRUE(ksn::intersect(capsule, ksn::Sphere3({0.0, 0.0, 0.7}, 0.5)));
+  EXPECT_FALSE(ksn::intersect(capsule, sphere));
+
+  ksn::Capsule3 crossing({0.0, -1.0, 1.0}, {0.0, 1.0, 1.0}, 0.75);
+  EXPECT_TRUE(ksn::intersect(capsule, crossing));
+
+  crossing.radius = 0.7;
+  EXPECT_FALSE(ksn::intersect(capsule, crossing));
+  EXPECT_TRUE(ksn::intersect(capsule, ksn::Capsule3(ksn::Sphere3({1.2, 0.0, 0.0}, 0.0))));
+}
@@ -0,0 +1,178 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+// Points on y = 0.5 * x + 1 with small noise, followed by uniform outliers.
+std::vector<ksn::Point2> line_points(std::mt19937 & generator)
+{
+  std::normal_distribution<double> noise(0.0, 0.01);
+  std::uniform_real_distribution<double> uniform(-5.0, 5.0);
+
+  std::vector<ksn::Point2> points;
+  for (int i = 0; i < 200; ++i) {
+    double x = uniform(generator);
+    points.push_back({x, 0.5 * x + 1.0 + noise(generator)});
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    points.push_back({uniform(generator), uniform(generator)});
+  }
+
+  return points;
+}
+
+}  // namespace
+
+TEST(RansacTest, InvalidArgument)
+{
+  EXPECT_THROW(ksn::Ransac<ksn::LineModel2>(0.0), std::invalid_argument);
+  EXPECT_THROW(ksn::Ransac<ksn::LineModel2>(0.1, 1.0), std::invalid_argument);
+
+  ksn::Ransac<ksn::LineModel2> ransac(0.1);
+  ksn::LineModel2 model;
+  EXPECT_FALSE(ransac.fit({{1.0, 1.0}}, model));
+  EXPECT_FALSE(ransac.fit({{1.0, 1.0}, {1.0, 1.0}}, model));
+}
+
+TEST(RansacTest, Line)
+{
+  std::mt19937 generator(42);
+  auto points = line_points(generator);
+
+  ksn::Ransac<ksn::LineModel2> ransac(0.05);
+  ksn::LineModel2 model;
+  ASSERT_TRUE(ransac.fit(points, model));
+
+  EXPECT_NEAR(std::abs(model.direction.cross(ksn::Point2(2.0, 1.0).normalize())), 0.0, 1e-3);
+  EXPECT_NEAR(model.squared_error({0.0, 1.0}), 0.0, 1e-4);
+
+  EXPECT_GE(ransac.get_inliers().size(), 195u);
+  EXPECT_LE(ransac.get_inliers().size(), 210u);
+  EXPECT_LT(ransac.get_iterations(), 1000u);
+}
+
+TEST(RansacTest, Circle)
+{
+  std::mt19937 generator(7);
+  std::normal_distribution<double> noise(0.0, 0.005);
+  std::uniform_real_distribution<double> uniform(-3.0, 3.0);
+
+  std::vector<ksn::Point2> points;
+  for (int i = 0; i < 120; ++i) {
+    double angle = i * 0.05;
+    double radius = 0.75 + noise(generator);
+    points.push_back({1.0 + radius * std::cos(angle), -0.5 + radius * std::sin(angle)});
+  }
+
+  for (int i = 0; i < 80; ++i) {
+    points.push_back({uniform(generator), uniform(generator)});
+  }
+
+  ksn::Ransac<ksn::CircleModel2> ransac(0.02);
+  ksn::CircleModel2 model;
+  ASSERT_TRUE(ransac.fit(points, model));
+
+  EXPECT_NEAR(model.center.x, 1.0, 0.01);
+  EXPECT_NEAR(model.center.y, -0.5, 0.01);
+  EXPECT_NEAR(model.radius, 0.75, 0.01);
+  EXPECT_GE(ransac.get_inliers().size(), 115u);
+}
+
+TEST(RansacTest, Plane)
+{
+  std::mt19937 generator(3);
+  std::normal_distribution<double> noise(0.0, 0.005);
+  std::uniform_real_distribution<double> uniform(-2.0, 2.0);
+
+  // Ground plane z = 0.1 * x - 0.2 * y + 0.3.
+  std::vector<ksn::Point3> points;
+  for (int i = 0; i < 300; ++i) {
+    double x = uniform(generator);
+    double y = uniform(generator);
+    points.push_back({x, y, 0.1 * x - 0.2 * y + 0.3 + noise(generator)});
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    points.push_back({uniform(generator), uniform(generator), uniform(generator)});
+  }
+
+  ksn::Ransac<ksn::PlaneModel3> ransac(0.02);
+  ksn::PlaneModel3 model;
+  ASSERT_TRUE(ransac.fit(points, model));
+
+  auto expected = ksn::Point3(-0.1, 0.2, 1.0);
+  expected = expected / expected.magnitude();
+  EXPECT_NEAR(std::abs(model.normal.dot(expected)), 1.0, 1e-4);
+  EXPECT_NEAR(model.squared_error({0.0, 0.0, 0.3}), 0.0, 1e-4);
+}
+
+TEST(RansacTest, EarlyTermination)
+{
+  std::vector<ksn::Point2> points;
+  for (int i = 0; i < 50; ++i) {
+    points.push_back({i * 0.1, 2.0});
+  }
+
+  ksn::Ransac<ksn::LineModel2> ransac(0.01);
+  ksn::LineModel2 model;
+  ASSERT_TRUE(ransac.fit(points, model));
+
+  EXPECT_EQ(ransac.get_iterations(), 1u);
+  EXPECT_EQ(ransac.get_inliers().size(), points.size());
+}
+
+TEST(RansacTest, BuildingBlocks)
+{
+  std::mt19937 generator(11);
+  auto points = line_points(generator);
+
+  ksn::Ransac<ksn::LineModel2> ransac(0.05, 0.99, 1000, 1234);
+
+  ksn::LineModel2 a, b;
+  ASSERT_TRUE(ransac.hypothesis(points, 17, a));
+  ASSERT_TRUE(ransac.hypothesis(points, 17, b));
+  EXPECT_EQ(a.point, b.point);
+  EXPECT_EQ(a.direction, b.direction);
+
+  // Counting split in ranges, as separate threads would, gives the same total.
+  size_t total = ransac.count_inliers(a, points, 0, points.size());
+  size_t split = ransac.count_inliers(a, points, 0, 100) +
+    ransac.count_inliers(a, points, 100, 250) +
+    ransac.count_inliers(a, points, 250, points.size());
+  EXPECT_EQ(split, total);
+
+  EXPECT_LE(ransac.count_inliers(a, points, 0, points.size(), points.size()), points.size());
+
+  EXPECT_EQ(ransac.required_iterations(300, 300), 1u);
+  EXPECT_EQ(ransac.required_iterations(0, 300), 1000u);
+  EXPECT_EQ(ransac.required_iterations(150, 300), 17u);
+}
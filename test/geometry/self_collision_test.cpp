@@ -0,0 +1,132 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+ksn::DualQuaternion<double> make_pose(double yaw, const ksn::Point3 & translation)
+{
+  auto rotation = ksn::Euler<double>(
+    ksn::make_degree(0.0), ksn::make_degree(0.0), ksn::make_degree(yaw)).quaternion();
+
+  return ksn::DualQuaternion<double>(rotation, translation);
+}
+
+// A torso with two arms hanging along the x axis, each arm a capsule in the frame of its link
+// and a sphere for the hand.
+ksn::SelfCollision make_robot()
+{
+  ksn::SelfCollision collision(3);
+  collision.add_capsule(0, ksn::Capsule3({0.0, -0.2, 0.0}, {0.0, 0.2, 0.0}, 0.1));
+  collision.add_capsule(1, ksn::Capsule3({0.0, 0.0, 0.0}, {0.5, 0.0, 0.0}, 0.05));
+  collision.add_sphere(1, ksn::Sphere3({0.55, 0.0, 0.0}, 0.06));
+  collision.add_capsule(2, ksn::Capsule3({0.0, 0.0, 0.0}, {0.5, 0.0, 0.0}, 0.05));
+  collision.add_sphere(2, ksn::Sphere3({0.55, 0.0, 0.0}, 0.06));
+
+  collision.ignore(0, 1);
+  collision.ignore(0, 2);
+
+  return collision;
+}
+
+// Both arms start at their shoulders and swing toward each other by the angle.
+std::vector<ksn::DualQuaternion<double>> make_link_poses(double angle)
+{
+  return {
+    ksn::DualQuaternion<double>::identity(),
+    make_pose(angle, {0.0, -0.3, 0.0}),
+    make_pose(-angle, {0.0, 0.3, 0.0}),
+  };
+}
+
+}  // namespace
+
+TEST(SelfCollisionTest, Shapes)
+{
+  auto collision = make_robot();
+  EXPECT_EQ(collision.get_link_count(), 3u);
+  EXPECT_EQ(collision.shape_count(), 5u);
+
+  EXPECT_THROW(
+    collision.add_sphere(3, ksn::Sphere3({0.0, 0.0, 0.0}, 0.1)), std::out_of_range);
+  EXPECT_THROW(collision.ignore(0, 3), std::out_of_range);
+
+  auto link_poses = make_link_poses(0.0);
+  link_poses.pop_back();
+  EXPECT_THROW(collision.collides(link_poses), std::invalid_argument);
+}
+
+TEST(SelfCollisionTest, Pose)
+{
+  auto collision = make_robot();
+
+  // Arms hanging apart only touch the torso, which is ignored.
+  EXPECT_FALSE(collision.collides(make_link_poses(0.0)));
+
+  // Swung toward each other the arms and hands meet at their ends.
+  std::vector<std::pair<size_t, size_t>> pairs;
+  EXPECT_TRUE(collision.collides(make_link_poses(30.0), pairs));
+  ASSERT_FALSE(pairs.empty());
+  for (const auto & pair : pairs) {
+    EXPECT_LT(pair.first, pair.second);
+    EXPECT_TRUE(pair.first == 1 || pair.first == 2);
+    EXPECT_TRUE(pair.second == 3 || pair.second == 4);
+  }
+
+  // Swung further the arms cross near the shoulders while the hands are apart again.
+  EXPECT_TRUE(collision.collides(make_link_poses(60.0), pairs));
+  EXPECT_EQ(pairs, (std::vector<std::pair<size_t, size_t>>{{1, 3}}));
+
+  collision.ignore(1, 2);
+  EXPECT_FALSE(collision.collides(make_link_poses(60.0)));
+}
+
+TEST(SelfCollisionTest, Trajectory)
+{
+  auto collision = make_robot();
+
+  std::vector<ksn::DualQuaternion<double>> trajectory;
+  std::vector<bool> expected;
+  for (int step = 0; step <= 12; ++step) {
+    auto link_poses = make_link_poses(step * 5.0);
+    trajectory.insert(trajectory.end(), link_poses.begin(), link_poses.end());
+
+    auto reference = make_robot();
+    expected.push_back(reference.collides(link_poses));
+  }
+
+  std::vector<bool> results;
+  collision.collides_along(trajectory, results);
+  EXPECT_EQ(results, expected);
+  EXPECT_FALSE(results.front());
+  EXPECT_TRUE(results.back());
+
+  trajectory.pop_back();
+  EXPECT_THROW(collision.collides_along(trajectory, results), std::invalid_argument);
+}
@@ -0,0 +1,194 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+std::vector<ksn::Point2> random_points(size_t count, std::mt19937 & generator)
+{
+  std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+
+  std::vector<ksn::Point2> points(count);
+  for (auto & point : points) {
+    point = ksn::Point2(distribution(generator), distribution(generator));
+  }
+
+  return points;
+}
+
+std::vector<size_t> brute_force_within(
+  const std::vector<ksn::Point2> & points, const ksn::Point2 & point, double radius)
+{
+  std::vector<size_t> indices;
+  for (size_t i = 0; i < points.size(); ++i) {
+    if ((points[i] - point).dot(points[i] - point) <= radius * radius) {
+      indices.push_back(i);
+    }
+  }
+
+  return indices;
+}
+
+std::vector<size_t> sorted_within(
+  const ksn::SpatialHash2 & hash, const ksn::Point2 & point, double radius)
+{
+  std::vector<size_t> indices;
+  std::vector<double> squared_distances;
+  hash.within(point, radius, indices, squared_distances);
+
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+}  // namespace
+
+TEST(SpatialHash2Test, InvalidCellSize)
+{
+  EXPECT_THROW(ksn::SpatialHash2(0.0), std::invalid_argument);
+  EXPECT_THROW(ksn::SpatialHash2(-1.0), std::invalid_argument);
+}
+
+TEST(SpatialHash2Test, Build)
+{
+  std::mt19937 generator(42);
+  auto points = random_points(2000, generator);
+
+  // Few buckets, so many cells share the same one.
+  ksn::SpatialHash2 hash(0.5, 64);
+  hash.build(points);
+  EXPECT_EQ(hash.size(), points.size());
+  EXPECT_EQ(hash.bucket_count(), 64u);
+
+  for (const auto & query : random_points(50, generator)) {
+    EXPECT_EQ(sorted_within(hash, query, 1.3), brute_force_within(points, query, 1.3));
+  }
+
+  std::vector<size_t> indices;
+  std::vector<double> squared_distances;
+  hash.within(points[3], 0.0, indices, squared_distances);
+  ASSERT_EQ(indices.size(), 1u);
+  EXPECT_EQ(indices[0], 3u);
+  EXPECT_DOUBLE_EQ(squared_distances[0], 0.0);
+}
+
+TEST(SpatialHash2Test, InsertAndClear)
+{
+  std::mt19937 generator(3);
+  auto points = random_points(300, generator);
+
+  ksn::SpatialHash2 hash(1.0);
+  hash.build(std::vector<ksn::Point2>(points.begin(), points.begin() + 100));
+  for (size_t i = 100; i < points.size(); ++i) {
+    EXPECT_EQ(hash.insert(points[i]), i);
+  }
+
+  for (const auto & query : random_points(50, generator)) {
+    EXPECT_EQ(sorted_within(hash, query, 2.0), brute_force_within(points, query, 2.0));
+  }
+
+  hash.clear();
+  EXPECT_TRUE(hash.empty());
+  EXPECT_TRUE(sorted_within(hash, points[0], 5.0).empty());
+
+  EXPECT_EQ(hash.insert(points[0]), 0u);
+  EXPECT_EQ(sorted_within(hash, points[0], 0.1), std::vector<size_t>({0}));
+}
+
+TEST(SpatialHash2Test, LargeRadius)
+{
+  std::mt19937 generator(7);
+  auto points = random_points(500, generator);
+
+  ksn::SpatialHash2 hash(0.25, 256);
+  hash.build(points);
+
+  // Spans more cells than there are buckets, so every point is scanned instead.
+  for (const auto & query : random_points(10, generator)) {
+    EXPECT_EQ(sorted_within(hash, query, 5.0), brute_force_within(points, query, 5.0));
+  }
+
+  EXPECT_EQ(sorted_within(hash, {0.0, 0.0}, 1e300).size(), points.size());
+
+  std::vector<size_t> indices;
+  std::vector<double> squared_distances;
+  EXPECT_THROW(
+    hash.within({0.0, 0.0}, std::numeric_limits<double>::infinity(), indices, squared_distances),
+    std::invalid_argument);
+  EXPECT_THROW(
+    hash.within({0.0, 0.0}, std::numeric_limits<double>::quiet_NaN(), indices, squared_distances),
+    std::invalid_argument);
+}
+
+TEST(SpatialHash2Test, FarAndNonFinitePoints)
+{
+  std::vector<ksn::Point2> points = {{1e300, -1e300}, {1e300 + 1e290, -1e300}, {0.5, 0.5}};
+
+  ksn::SpatialHash2 hash(0.25);
+  hash.build(points);
+
+  EXPECT_EQ(sorted_within(hash, {1e300, -1e300}, 1.0), std::vector<size_t>({0}));
+  EXPECT_EQ(sorted_within(hash, {0.5, 0.5}, 1.0), std::vector<size_t>({2}));
+
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  double infinity = std::numeric_limits<double>::infinity();
+  EXPECT_THROW(hash.insert({nan, 0.0}), std::invalid_argument);
+  EXPECT_THROW(hash.insert({0.0, -infinity}), std::invalid_argument);
+  EXPECT_EQ(hash.size(), points.size());
+
+  points.push_back({nan, nan});
+  EXPECT_THROW(hash.build(points), std::invalid_argument);
+}
+
+TEST(SpatialHash2Test, ChunkedBuild)
+{
+  std::mt19937 generator(7);
+  auto points = random_points(1001, generator);
+
+  ksn::SpatialHash2 hash(0.75, 256);
+  hash.prepare_build(points.size(), 4);
+
+  // Chunks are independent, so their order does not matter.
+  for (size_t chunk : {2, 0, 3, 1}) {
+    hash.count_chunk(points, chunk);
+  }
+
+  hash.finish_count();
+
+  for (size_t chunk : {1, 3, 0, 2}) {
+    hash.scatter_chunk(points, chunk);
+  }
+
+  for (const auto & query : random_points(50, generator)) {
+    EXPECT_EQ(sorted_within(hash, query, 1.0), brute_force_within(points, query, 1.0));
+  }
+
+  EXPECT_THROW(hash.count_chunk(random_points(10, generator), 0), std::invalid_argument);
+}
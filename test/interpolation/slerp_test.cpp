@@ -0,0 +1,162 @@
+// Copyright (c) 2026 ICHIRO ITS
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "keisan/interpolation/slerp.hpp"
+#include "keisan/keisan.hpp"
+
+namespace ksn = keisan;
+
+namespace
+{
+
+ksn::Quaternion<double> make_yaw(double degree)
+{
+  return ksn::Euler<double>(
+    ksn::make_degree(0.0), ksn::make_degree(0.0), ksn::make_degree(degree)).quaternion();
+}
+
+}  // namespace
+
+#define EXPECT_QUATERNION_NEAR(A, B, ERROR) \
+  { \
+    EXPECT_NEAR(A.x, B.x, ERROR); \
+    EXPECT_NEAR(A.y, B.y, ERROR); \
+    EXPECT_NEAR(A.z, B.z, ERROR); \
+    EXPECT_NEAR(A.w, B.w, ERROR); \
+  }
+
+TEST(SlerpTest, Endpoints)
+{
+  auto from = make_yaw(10.0);
+  auto to = make_yaw(130.0);
+
+  EXPECT_QUATERNION_NEAR(ksn::slerp(from, to, 0.0), from, 1e-12);
+  EXPECT_QUATERNION_NEAR(ksn::slerp(from, to, 1.0), to, 1e-12);
+  EXPECT_QUATERNION_NEAR(ksn::nlerp(from, to, 0.0), from, 1e-12);
+  EXPECT_QUATERNION_NEAR(ksn::nlerp(from, to, 1.0), to, 1e-12);
+}
+
+TEST(SlerpTest, ConstantAngularVelocity)
+{
+  auto from = make_yaw(0.0);
+  auto to = make_yaw(120.0);
+
+  for (double t = 0.0; t <= 1.0; t += 0.125) {
+    EXPECT_QUATERNION_NEAR(ksn::slerp(from, to, t), make_yaw(120.0 * t), 1e-12);
+  }
+
+  EXPECT_QUATERNION_NEAR(ksn::nlerp(from, to, 0.5), make_yaw(60.0), 1e-12);
+  EXPECT_NEAR(ksn::nlerp(from, to, 0.25).magnitude(), 1.0, 1e-12);
+}
+
+TEST(SlerpTest, ShortestPath)
+{
+  auto from = make_yaw(170.0);
+  auto to = make_yaw(-170.0);
+
+  auto middle = ksn::slerp(from, to, 0.5);
+  EXPECT_NEAR(std::abs(middle.euler().yaw.degree()), 180.0, 1e-9);
+
+  middle = ksn::slerp(from, -to, 0.5);
+  EXPECT_NEAR(std::abs(middle.euler().yaw.degree()), 180.0, 1e-9);
+
+  EXPECT_QUATERNION_NEAR(ksn::slerp(from, from, 0.3), from, 1e-12);
+}
+
+TEST(SlerpTest, Batch)
+{
+  auto from = ksn::Euler<double>(
+    ksn::make_degree(15.0), ksn::make_degree(-40.0), ksn::make_degree(70.0)).quaternion();
+  auto to = ksn::Euler<double>(
+    ksn::make_degree(-25.0), ksn::make_degree(30.0), ksn::make_degree(-110.0)).quaternion();
+
+  std::vector<double> ts;
+  for (int i = 0; i <= 20; ++i) {
+    ts.push_back(i / 20.0);
+  }
+
+  std::vector<ksn::Quaternion<double>> results;
+
+  ksn::slerp(from, to, ts, results);
+  ASSERT_EQ(results.size(), ts.size());
+  for (size_t i = 0; i < ts.size(); ++i) {
+    EXPECT_QUATERNION_NEAR(results[i], ksn::slerp(from, to, ts[i]), 1e-12);
+  }
+
+  ksn::nlerp(from, to, ts, results);
+  ASSERT_EQ(results.size(), ts.size());
+  for (size_t i = 0; i < ts.size(); ++i) {
+    EXPECT_QUATERNION_NEAR(results[i], ksn::nlerp(from, to, ts[i]), 1e-12);
+  }
+}
+
+TEST(SlerpTest, Squad)
+{
+  auto a = make_yaw(0.0);
+  auto b = make_yaw(30.0);
+  auto c = make_yaw(60.0);
+
+  EXPECT_QUATERNION_NEAR(ksn::squad_control(a, b, c), b, 1e-12);
+
+  for (double t = 0.0; t <= 1.0; t += 0.25) {
+    EXPECT_QUATERNION_NEAR(ksn::squad(a, a, b, b, t), ksn::slerp(a, b, t), 1e-12);
+  }
+
+  auto d = ksn::Euler<double>(
+    ksn::make_degree(20.0), ksn::make_degree(10.0), ksn::make_degree(90.0)).quaternion();
+  auto b_control = ksn::squad_control(a, b, c);
+  auto c_control = ksn::squad_control(b, c, d);
+
+  EXPECT_QUATERNION_NEAR(ksn::squad(b, b_control, c_control, c, 0.0), b, 1e-12);
+  EXPECT_QUATERNION_NEAR(ksn::squad(b, b_control, c_control, c, 1.0), c, 1e-12);
+  EXPECT_NEAR(ksn::squad(b, b_control, c_control, c, 0.4).magnitude(), 1.0, 1e-12);
+}
+
+TEST(SlerpTest, SquadAntipodal)
+{
+  auto a = make_yaw(0.0);
+  auto b = make_yaw(50.0);
+  auto c = make_yaw(80.0);
+
+  // The control quaternions are antipodal, so is the inner arc.
+  auto control = -b;
+  for (double t = 0.0; t <= 1.0; t += 0.125) {
+    auto result = ksn::squad(a, b, control, c, t);
+    EXPECT_TRUE(std::isfinite(result.w)) << "at " << t;
+    EXPECT_NEAR(result.magnitude(), 1.0, 1e-12) << "at " << t;
+  }
+
+  EXPECT_QUATERNION_NEAR(ksn::squad(a, b, control, c, 0.0), a, 1e-12);
+  EXPECT_QUATERNION_NEAR(ksn::squad(a, b, control, c, 1.0), c, 1e-12);
+
+  // Controls antipodal to the ends make the final arc antipodal.
+  for (double t = 0.0; t <= 1.0; t += 0.125) {
+    auto result = ksn::squad(a, -a, -a, a, t);
+    EXPECT_TRUE(std::isfinite(result.w)) << "at " << t;
+    EXPECT_NEAR(result.magnitude(), 1.0, 1e-12) << "at " << t;
+  }
+
+  EXPECT_QUATERNION_NEAR(ksn::squad(a, -a, -a, a, 0.0), a, 1e-12);
+  EXPECT_QUATERNION_NEAR(ksn::squad(a, -a, -a, a, 1.0), a, 1e-12);
+}
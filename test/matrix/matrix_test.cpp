@@ -252,3 +252,42 @@ TEST(MatrixTest, NegationOperation)
     -2.0, -2.0, -2.0, -2.0,
     -3.0, -3.0, -3.0, -3.0);
 }
+
+TEST(MatrixTest, SymmetricEigen)
+{
+  ksn::Matrix<4, 4> matrix(
+    4.0, 1.0, -2.0, 2.0,
+    1.0, 2.0, 0.0, 1.0,
+    -2.0, 0.0, 3.0, -2.0,
+    2.0, 1.0, -2.0, -1.0);
+
+  ksn::Vector<4> eigenvalues;
+  ksn::Matrix<4, 4> eigenvectors;
+  matrix.symmetric_eigen(eigenvalues, eigenvectors);
+
+  for (size_t i = 0; i < 4; ++i) {
+    if (i > 0) {
+      EXPECT_GE(eigenvalues[i - 1], eigenvalues[i]);
+    }
+
+    for (size_t row = 0; row < 4; ++row) {
+      double product = 0.0;
+      for (size_t column = 0; column < 4; ++column) {
+        product += matrix[row][column] * eigenvectors[column][i];
+      }
+
+      EXPECT_NEAR(product, eigenvalues[i] * eigenvectors[row][i], 1e-12);
+    }
+  }
+
+  EXPECT_NEAR(eigenvalues[0] + eigenvalues[1] + eigenvalues[2] + eigenvalues[3], 8.0, 1e-12);
+
+  ksn::Matrix<2, 2> diagonal(1.0, 0.0, 0.0, 3.0);
+  ksn::Vector<2> diagonal_eigenvalues;
+  ksn::Matrix<2, 2> diagonal_eigenvectors;
+  diagonal.symmetric_eigen(diagonal_eigenvalues, diagonal_eigenvectors);
+
+  EXPECT_DOUBLE_EQ(diagonal_eigenvalues[0], 3.0);
+  EXPECT_DOUBLE_EQ(diagonal_eigenvalues[1], 1.0);
+  EXPECT_DOUBLE_EQ(std::abs(diagonal_eigenvectors[1][0]), 1.0);
+}
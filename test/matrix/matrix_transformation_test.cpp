@@ -18,6 +18,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "keisan/keisan.hpp"
 
@@ -212,3 +214,69 @@ TEST(MatrixTransformationTest, Transformation)
     -1e-16, 0.0, -1.0, 1.0,
     0.0, 0.0, 0.0, 1.0);
 }
+
+TEST(MatrixTransformationTest, EulerRotation)
+{
+  auto euler = ksn::Euler<double>(
+    ksn::make_degree(0.0), ksn::make_degree(90.0), ksn::make_degree(0.0));
+
+  ASSERT_MATRIX_M_N_NEAR(
+    4, 4, ksn::rotation_matrix(euler),
+    0.0, 0.0, 1.0, 0.0,
+    0.0, 1.0, 0.0, 0.0,
+    -1.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 1.0);
+
+  euler = ksn::Euler<double>(
+    ksn::make_degree(30.0), ksn::make_degree(-45.0), ksn::make_degree(120.0));
+
+  auto zero = ksn::make_degree(0.0);
+  auto roll = ksn::rotation_matrix(ksn::Euler<double>(euler.roll, zero, zero));
+  auto pitch = ksn::rotation_matrix(ksn::Euler<double>(zero, euler.pitch, zero));
+  auto yaw = ksn::rotation_matrix(ksn::Euler<double>(zero, zero, euler.yaw));
+  auto expected = (yaw * pitch) * roll;
+  auto matrix = ksn::rotation_matrix(euler);
+
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      EXPECT_NEAR(matrix[i][j], expected[i][j], 1e-12);
+    }
+  }
+}
+
+TEST(MatrixTransformationTest, QuaternionRotation)
+{
+  std::vector<ksn::Euler<double>> eulers = {
+    ksn::Euler<double>(ksn::make_degree(0.0), ksn::make_degree(0.0), ksn::make_degree(0.0)),
+    ksn::Euler<double>(ksn::make_degree(30.0), ksn::make_degree(-45.0), ksn::make_degree(120.0)),
+    ksn::Euler<double>(ksn::make_degree(180.0), ksn::make_degree(0.0), ksn::make_degree(0.0)),
+    ksn::Euler<double>(ksn::make_degree(0.0), ksn::make_degree(180.0), ksn::make_degree(0.0)),
+    ksn::Euler<double>(ksn::make_degree(0.0), ksn::make_degree(0.0), ksn::make_degree(180.0)),
+    ksn::Euler<double>(ksn::make_degree(-170.0), ksn::make_degree(80.0), ksn::make_degree(-60.0)),
+  };
+
+  for (const auto & euler : eulers) {
+    auto quaternion = euler.quaternion();
+    auto expected = ksn::rotation_matrix(euler);
+
+    auto matrix = ksn::rotation_matrix(quaternion);
+    for (size_t i = 0; i < 4; ++i) {
+      for (size_t j = 0; j < 4; ++j) {
+        EXPECT_NEAR(matrix[i][j], expected[i][j], 1e-12);
+      }
+    }
+
+    auto scaled = ksn::Quaternion<double>(
+      quaternion.x * 3.0, quaternion.y * 3.0, quaternion.z * 3.0, quaternion.w * 3.0);
+    matrix = ksn::rotation_matrix(scaled);
+    EXPECT_NEAR(matrix[0][0], expected[0][0], 1e-12);
+    EXPECT_NEAR(matrix[1][2], expected[1][2], 1e-12);
+
+    auto result = ksn::rotation_quaternion(expected);
+    double sign = (result.dot(quaternion) < 0.0) ? -1.0 : 1.0;
+    EXPECT_NEAR(sign * result.x, quaternion.x, 1e-12);
+    EXPECT_NEAR(sign * result.y, quaternion.y, 1e-12);
+    EXPECT_NEAR(sign * result.z, quaternion.z, 1e-12);
+    EXPECT_NEAR(sign * result.w, quaternion.w, 1e-12);
+  }
+}
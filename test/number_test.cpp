@@ -18,6 +18,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 #include "keisan/keisan.hpp"
 
@@ -369,3 +371,50 @@ TEST(NumberTest, SmoothValue)
     66.807, 69.5425, 72.0591, 74.3743, 76.5044, 78.464, 80.2669, 81.9256, 83.4515, 84.8554, 86.147,
     87.3352, 88.4284, 89.4341, 90.3594, 91.2106, 91.9938, 92.7143, 93.3771);
 }
+
+TEST(NumberTest, WrapAllIntegral)
+{
+  std::vector<int> values;
+  for (int value = -20; value <= 40; ++value) {
+    values.push_back(value);
+  }
+
+  auto wrapped = values;
+  ksn::wrap_all(wrapped, 10, 15);
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(wrapped[i], ksn::wrap(values[i], 10, 15)) << "at " << values[i];
+  }
+}
+
+TEST(NumberTest, WrapAllFloatingPoint)
+{
+  std::vector<double> values;
+  for (double value = -3.0; value <= 3.0; value += 0.01) {
+    values.push_back(value);
+  }
+
+  values.push_back(0.3 - 1e-17);
+  values.push_back(-0.5 + 1e-17);
+
+  auto wrapped = values;
+  ksn::wrap_all(wrapped, -0.1, 0.3);
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(wrapped[i], ksn::wrap(values[i], -0.1, 0.3)) << "at " << values[i];
+  }
+}
+
+TEST(NumberTest, WrapAllWithinPeriod)
+{
+  std::vector<double> values = {
+    -std::nextafter(1.0, 0.0), -0.75, -std::nextafter(0.0, 1.0), 0.0, 0.5,
+    std::nextafter(1.0, 0.0)};
+
+  auto wrapped = values;
+  ksn::wrap_all(wrapped, 0.0, 1.0);
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(wrapped[i], ksn::wrap(values[i], 0.0, 1.0)) << "at " << values[i];
+  }
+}